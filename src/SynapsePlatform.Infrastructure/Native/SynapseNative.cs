@@ -0,0 +1,73 @@
+using System.Runtime.InteropServices;
+
+namespace SynapsePlatform.Infrastructure.Native;
+
+/// <summary>
+/// P/Invoke bindings for libsynapse_native (src/algorithms/capi/synapse_capi.h)
+/// </summary>
+/// <remarks>
+/// Arrays are blittable, so the runtime pins them and passes them straight
+/// through: a whole batch is one native call with no per-item marshalling.
+/// When the library is missing, IsAvailable is false and callers fall back
+/// to their managed implementation.
+/// </remarks>
+internal static class SynapseNative
+{
+    private const string LibraryName = "synapse_native";
+    private const uint ExpectedAbiVersion = 1;
+    private const int StatusOk = 0;
+
+    private static readonly Lazy<bool> _isAvailable = new(Probe);
+
+    public static bool IsAvailable => _isAvailable.Value;
+
+    [DllImport(LibraryName, EntryPoint = "synapse_capi_version", ExactSpelling = true,
+        CallingConvention = CallingConvention.Cdecl)]
+    private static extern uint CapiVersion();
+
+    [DllImport(LibraryName, EntryPoint = "synapse_idi_calculate_batch", ExactSpelling = true,
+        CallingConvention = CallingConvention.Cdecl)]
+    private static extern int IdiCalculateBatch(
+        int[] days,
+        int[] locChanged,
+        int[] dependencies,
+        nuint count,
+        double minLocFactor,
+        [Out] double[] outIdi);
+
+    /// <summary>
+    /// IDI for every element in one native call
+    /// </summary>
+    /// <returns>false if the native library is unavailable or rejected the input</returns>
+    public static bool TryCalculateIDIBatch(int[] days, int[] locChanged, int[] dependencies,
+        double minLocFactor, double[] result)
+    {
+        if (!IsAvailable) return false;
+        if (days.Length != result.Length || locChanged.Length != result.Length ||
+            dependencies.Length != result.Length) return false;
+        if (result.Length == 0) return true;
+
+        return IdiCalculateBatch(days, locChanged, dependencies, (nuint)result.Length,
+            minLocFactor, result) == StatusOk;
+    }
+
+    private static bool Probe()
+    {
+        try
+        {
+            return CapiVersion() == ExpectedAbiVersion;
+        }
+        catch (DllNotFoundException)
+        {
+            return false;
+        }
+        catch (EntryPointNotFoundException)
+        {
+            return false;
+        }
+        catch (BadImageFormatException)
+        {
+            return false;
+        }
+    }
+}
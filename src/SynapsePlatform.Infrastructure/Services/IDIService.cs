@@ -3,6 +3,7 @@ using SynapsePlatform.Core.Entities;
 using SynapsePlatform.Core.Enums;
 using SynapsePlatform.Core.Interfaces;
 using SynapsePlatform.Infrastructure.Data;
+using SynapsePlatform.Infrastructure.Native;
 
 namespace SynapsePlatform.Infrastructure.Services;
 
@@ -15,17 +16,44 @@ public class IDIService : IIDIService
         _context = context;
     }
 
+    private const double MinFactor = 0.1;
+
     // IDI = (Days Since Last Integration) × (LoC Changed / 1000) × (Dependencies / 10)
     public double CalculateComponentIDI(Component component)
     {
-        var daysSinceIntegration = component.LastIntegrationDate.HasValue
-            ? (DateTime.UtcNow - component.LastIntegrationDate.Value).Days
-            : component.DaysSinceLastIntegration;
+        // Same clamping as synapse_idi_calculate_batch, so the fallback matches the native path
+        var daysSinceIntegration = Math.Max(DaysSinceIntegration(component), 0);
+
+        var locFactor = Math.Max(Math.Max(component.LinesOfCodeChanged, 0) / 1000.0, MinFactor);
+        var depFactor = Math.Max(component.DependencyCount, 1) / 10.0;
+
+        return daysSinceIntegration * locFactor * depFactor;
+    }
+
+    /// <summary>
+    /// IDI for a whole component list in one native call (libsynapse_native),
+    /// falling back to CalculateComponentIDI when the library is not deployed
+    /// </summary>
+    public double[] CalculateIDIBatch(IReadOnlyList<Component> components)
+    {
+        var result = new double[components.Count];
+        var days = new int[components.Count];
+        var loc = new int[components.Count];
+        var deps = new int[components.Count];
 
-        var locFactor = component.LinesOfCodeChanged / 1000.0;
-        var depFactor = component.DependencyCount / 10.0;
+        for (var i = 0; i < components.Count; i++)
+        {
+            days[i] = DaysSinceIntegration(components[i]);
+            loc[i] = components[i].LinesOfCodeChanged;
+            deps[i] = components[i].DependencyCount;
+        }
+
+        if (SynapseNative.TryCalculateIDIBatch(days, loc, deps, MinFactor, result))
+            return result;
 
-        return daysSinceIntegration * Math.Max(locFactor, 0.1) * Math.Max(depFactor, 0.1);
+        for (var i = 0; i < components.Count; i++)
+            result[i] = CalculateComponentIDI(components[i]);
+        return result;
     }
 
     public double CalculateProjectIDI(Guid projectId)
@@ -36,7 +64,7 @@ public class IDIService : IIDIService
 
         if (!components.Any()) return 0;
 
-        return components.Average(c => CalculateComponentIDI(c));
+        return CalculateIDIBatch(components).Average();
     }
 
     public async Task<IDIReport> GetIDIReportAsync(Guid projectId)
@@ -45,19 +73,14 @@ public class IDIService : IIDIService
             .Where(c => c.ProjectId == projectId && !c.IsDeleted)
             .ToListAsync();
 
-        var componentInfos = components.Select(c =>
+        var idis = CalculateIDIBatch(components);
+        var componentInfos = components.Select((c, i) => new ComponentIDIInfo
         {
-            var idi = CalculateComponentIDI(c);
-            return new ComponentIDIInfo
-            {
-                ComponentId = c.Id,
-                ComponentName = c.Name,
-                IDI = idi,
-                Status = GetIDIStatus(idi),
-                DaysSinceLastIntegration = c.LastIntegrationDate.HasValue
-                    ? (DateTime.UtcNow - c.LastIntegrationDate.Value).Days
-                    : c.DaysSinceLastIntegration
-            };
+            ComponentId = c.Id,
+            ComponentName = c.Name,
+            IDI = idis[i],
+            Status = GetIDIStatus(idis[i]),
+            DaysSinceLastIntegration = DaysSinceIntegration(c)
         }).ToList();
 
         var projectIDI = componentInfos.Any() ? componentInfos.Average(c => c.IDI) : 0;
@@ -94,7 +117,20 @@ public class IDIService : IIDIService
             .Where(c => c.ProjectId == projectId && !c.IsDeleted)
             .ToListAsync();
 
-        return components.Where(c => CalculateComponentIDI(c) > 3.0).OrderByDescending(c => CalculateComponentIDI(c));
+        var idis = CalculateIDIBatch(components);
+        return components
+            .Select((c, i) => (Component: c, IDI: idis[i]))
+            .Where(x => x.IDI > 3.0)
+            .OrderByDescending(x => x.IDI)
+            .Select(x => x.Component)
+            .ToList();
+    }
+
+    private static int DaysSinceIntegration(Component component)
+    {
+        return component.LastIntegrationDate.HasValue
+            ? (DateTime.UtcNow - component.LastIntegrationDate.Value).Days
+            : component.DaysSinceLastIntegration;
     }
 
     private static IDIStatus GetIDIStatus(double idi)
@@ -0,0 +1,504 @@
+/**
+ * SYNAPSE Neural Connection Layer - Deterministic Record / Replay
+ * ===============================================================
+ *
+ * Captures everything a HardwareSoftwareBalancer decision depends on
+ * (telemetry input, throttle, every clock read, history and thresholds
+ * snapshots) in a compact binary log, and replays it deterministically
+ * and faster than real time to reproduce or diff decisions.
+ *
+ * File layout (host byte order, fixed-width fields, no padding):
+ *   header     : "SYNREC01" | u32 version | f64 target_throughput
+ *   STATE      : u8 1 | thresholds | u8 hysteresis
+ *                | [hysteresis config | u8 state | u16 dwell]
+ *                | u32 n | n x metrics
+ *   INPUT      : u8 2 | str component_id | i64 ts_ns | 6 x f64 | u8 flags
+ *                | [f64 temperature] | [f64 power] | f64 throttle
+ *   CLOCK      : u8 3 | i64 ns
+ *   DECISION   : u8 4 | u8 action | f64 throttle_level | f64 imbalance
+ *
+ *   thresholds : u64 version | 14 x f64 in RuntimeThresholds order
+ *   hysteresis : 4 x f64 (throttle_enter, throttle_exit, boost_enter,
+ *                boost_exit) | u16 min_dwell_ticks
+ *   metrics    : f64 hw_capacity | f64 sw_demand | f64 imbalance | i64 ts_ns
+ *
+ * STATE carries the hysteresis config and state of a balancer with
+ * setHysteresis(), so replay is deterministic from any snapshot.
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#ifndef SYNAPSE_BALANCE_REPLAY_HPP
+#define SYNAPSE_BALANCE_REPLAY_HPP
+
+#include "balancing_algorithm.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace synapse {
+namespace neural {
+namespace replay {
+
+// =============================================================================
+// FORMAT
+// =============================================================================
+
+constexpr char MAGIC[8] = {'S', 'Y', 'N', 'R', 'E', 'C', '0', '1'};
+constexpr std::uint32_t FORMAT_VERSION = 3;
+
+enum RecordTag : std::uint8_t {
+    TAG_STATE = 1,
+    TAG_INPUT = 2,
+    TAG_CLOCK = 3,
+    TAG_DECISION = 4
+};
+
+struct Decision {
+    MitigationAction action = MitigationAction::NONE;
+    double throttle_level = 0.0;
+    double imbalance = 0.0;
+
+    bool operator==(const Decision& other) const {
+        return action == other.action
+            && throttle_level == other.throttle_level
+            && imbalance == other.imbalance;
+    }
+    bool operator!=(const Decision& other) const { return !(*this == other); }
+};
+
+/**
+ * Serialized fields of the snapshot structs, shared by writer and reader
+ * so the on-disk order never depends on the struct layout
+ */
+template <typename T, typename Fn>
+void thresholdFields(T& t, Fn&& field) {
+    field(t.version);
+    field(t.idi_healthy);
+    field(t.idi_warning);
+    field(t.idi_critical);
+    field(t.idi_quarantine);
+    field(t.cpu_warning);
+    field(t.cpu_critical);
+    field(t.cpu_emergency);
+    field(t.memory_warning);
+    field(t.memory_critical);
+    field(t.temperature_warning);
+    field(t.temperature_critical);
+    field(t.temperature_shutdown);
+    field(t.hw_sw_imbalance_threshold);
+    field(t.latency_warning_ms);
+    field(t.latency_critical_ms);
+}
+
+template <typename T, typename Fn>
+void hysteresisFields(T& c, Fn&& field) {
+    field(c.throttle_enter);
+    field(c.throttle_exit);
+    field(c.boost_enter);
+    field(c.boost_exit);
+    field(c.min_dwell_ticks);
+}
+
+class BinaryWriter {
+private:
+    std::ostream& out_;
+
+public:
+    explicit BinaryWriter(std::ostream& out) : out_(out) {}
+
+    template <typename T>
+    void pod(const T& value) {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "Fixed-width fields only");
+        out_.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void str(const std::string& value) {
+        pod(static_cast<std::uint16_t>(value.size()));
+        out_.write(value.data(), static_cast<std::streamsize>(value.size()));
+    }
+
+    static std::int64_t nanos(std::chrono::system_clock::time_point tp) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(tp.time_since_epoch()).count();
+    }
+
+    void time(std::chrono::system_clock::time_point tp) { pod(nanos(tp)); }
+
+    void thresholds(const RuntimeThresholds& t) {
+        thresholdFields(t, [this](const auto& f) { pod(f); });
+    }
+
+    void hysteresis(const HysteresisConfig& c) {
+        hysteresisFields(c, [this](const auto& f) { pod(f); });
+    }
+
+    void metrics(const BalanceMetrics& m) {
+        pod(m.hw_capacity);
+        pod(m.sw_demand);
+        pod(m.imbalance);
+        time(m.timestamp);
+    }
+
+    void decision(const Decision& d) {
+        pod(TAG_DECISION);
+        pod(static_cast<std::uint8_t>(d.action));
+        pod(d.throttle_level);
+        pod(d.imbalance);
+    }
+};
+
+class BinaryReader {
+private:
+    std::istream& in_;
+
+public:
+    explicit BinaryReader(std::istream& in) : in_(in) {}
+
+    template <typename T>
+    bool pod(T& value) {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "Fixed-width fields only");
+        return static_cast<bool>(in_.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+
+    bool str(std::string& value) {
+        std::uint16_t size = 0;
+        if (!pod(size)) return false;
+        value.resize(size);
+        return size == 0 || static_cast<bool>(in_.read(&value[0], size));
+    }
+
+    bool time(std::chrono::system_clock::time_point& tp) {
+        std::int64_t ns = 0;
+        if (!pod(ns)) return false;
+        tp = std::chrono::system_clock::time_point(
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(ns)));
+        return true;
+    }
+
+    bool thresholds(RuntimeThresholds& t) {
+        bool ok = true;
+        thresholdFields(t, [&](auto& f) { ok = ok && pod(f); });
+        return ok;
+    }
+
+    bool hysteresis(HysteresisConfig& c) {
+        bool ok = true;
+        hysteresisFields(c, [&](auto& f) { ok = ok && pod(f); });
+        return ok;
+    }
+
+    bool metrics(BalanceMetrics& m) {
+        return pod(m.hw_capacity) && pod(m.sw_demand) && pod(m.imbalance) && time(m.timestamp);
+    }
+
+    /**
+     * Decision body (tag already consumed)
+     */
+    bool decision(Decision& d) {
+        std::uint8_t action = 0;
+        if (!pod(action) || !pod(d.throttle_level) || !pod(d.imbalance)) return false;
+        d.action = static_cast<MitigationAction>(action);
+        return true;
+    }
+};
+
+// =============================================================================
+// RECORDER
+// =============================================================================
+
+/**
+ * Records every balance() call of one balancer
+ *
+ * Installs itself as the balancer's clock for its lifetime and forwards
+ * to `upstream` (system clock when null). Single-threaded: route all
+ * balance() calls for the recorded balancer through this object. A
+ * state snapshot is also written before the first tick after any change
+ * outside balance() (a new thresholds version, setHysteresis(),
+ * clearHysteresis(), restoreHistory(), repeatLast(), ...; see
+ * HardwareSoftwareBalancer::stateGeneration()), so such changes replay
+ * at the right tick even when made directly on the balancer.
+ */
+class BalanceRecorder : public ClockSource {
+private:
+    HardwareSoftwareBalancer& balancer_;
+    BinaryWriter out_;
+    ClockSource* upstream_;
+    std::uint64_t ticks_ = 0;
+    std::uint64_t state_interval_;
+    std::uint64_t thresholds_version_ = 0;
+    std::uint64_t state_generation_ = 0;
+
+public:
+    /**
+     * @param state_interval Write a state snapshot every N ticks (0 = only at start)
+     */
+    BalanceRecorder(HardwareSoftwareBalancer& balancer, std::ostream& out,
+                    std::uint64_t state_interval = 0, ClockSource* upstream = nullptr)
+        : balancer_(balancer), out_(out), upstream_(upstream), state_interval_(state_interval) {
+        out.write(MAGIC, sizeof(MAGIC));
+        out_.pod(FORMAT_VERSION);
+        out_.pod(balancer_.targetThroughput());
+        writeState();
+        balancer_.setClock(this);
+    }
+
+    ~BalanceRecorder() override { balancer_.setClock(upstream_); }
+
+    BalanceRecorder(const BalanceRecorder&) = delete;
+    BalanceRecorder& operator=(const BalanceRecorder&) = delete;
+
+    std::chrono::system_clock::time_point now() override {
+        auto t = upstream_ ? upstream_->now() : std::chrono::system_clock::now();
+        out_.pod(TAG_CLOCK);
+        out_.time(t);
+        return t;
+    }
+
+    void writeState() {
+        state_generation_ = balancer_.stateGeneration();
+        const RuntimeThresholds thresholds = balancer_.thresholds();
+        thresholds_version_ = thresholds.version;
+        out_.pod(TAG_STATE);
+        out_.thresholds(thresholds);
+        auto hysteresis = balancer_.hysteresisSnapshot();
+        out_.pod(static_cast<std::uint8_t>(hysteresis.config ? 1 : 0));
+        if (hysteresis.config) {
+            out_.hysteresis(*hysteresis.config);
+            out_.pod(hysteresis.state);
+            out_.pod(hysteresis.dwell);
+        }
+        auto history = balancer_.getRecentMetrics(balancer_.movingAverageWindow() * 2);
+        out_.pod(static_cast<std::uint32_t>(history.size()));
+        for (const auto& m : history) out_.metrics(m);
+    }
+
+    MitigationResult balance(const TelemetryData& telemetry, double current_throttle) {
+        if ((state_interval_ && ticks_ && ticks_ % state_interval_ == 0)
+            || balancer_.thresholds().version != thresholds_version_
+            || balancer_.stateGeneration() != state_generation_) {
+            writeState();
+        }
+
+        out_.pod(TAG_INPUT);
+        out_.str(telemetry.component_id);
+        out_.time(telemetry.timestamp);
+        out_.pod(telemetry.cpu_usage);
+        out_.pod(telemetry.memory_usage);
+        out_.pod(telemetry.io_latency_ms);
+        out_.pod(telemetry.network_latency_ms);
+        out_.pod(telemetry.error_rate);
+        out_.pod(telemetry.throughput);
+        std::uint8_t flags = (telemetry.temperature ? 1 : 0) | (telemetry.power_consumption ? 2 : 0);
+        out_.pod(flags);
+        if (telemetry.temperature) out_.pod(*telemetry.temperature);
+        if (telemetry.power_consumption) out_.pod(*telemetry.power_consumption);
+        out_.pod(current_throttle);
+
+        MitigationResult result = balancer_.balance(telemetry, current_throttle);
+        out_.decision({result.action, result.throttle_level, result.imbalance});
+
+        ++ticks_;
+        return result;
+    }
+
+    std::uint64_t ticks() const { return ticks_; }
+};
+
+// =============================================================================
+// REPLAYER
+// =============================================================================
+
+struct ReplayStats {
+    std::uint64_t ticks = 0;
+    std::uint64_t mismatches = 0;
+    std::uint64_t clock_underruns = 0;  // Replayed build read the clock more often
+    std::uint64_t clock_overruns = 0;   // ... or less often than the recording
+    double seconds = 0.0;
+    bool truncated = false;
+    bool hysteresis = false;            // Recording had hysteresis enabled
+};
+
+/**
+ * Replays a recording against this build's balancer
+ *
+ * Clock reads are served from the recorded CLOCK records of the current
+ * tick, so the run is deterministic and not paced by wall time.
+ */
+class BalanceReplayer : public ClockSource {
+private:
+    BinaryReader in_;
+    bool valid_ = false;
+    std::uint32_t version_ = 0;
+    double target_throughput_ = 1000.0;
+    bool hysteresis_ = false;
+
+    std::deque<std::chrono::system_clock::time_point> clock_;
+    std::chrono::system_clock::time_point last_clock_{};
+    std::uint64_t underruns_ = 0;
+
+    bool readState(HardwareSoftwareBalancer& balancer, ThresholdStore& thresholds) {
+        RuntimeThresholds recorded;
+        std::uint8_t has_hysteresis = 0;
+        if (!in_.thresholds(recorded) || !in_.pod(has_hysteresis)) return false;
+
+        HardwareSoftwareBalancer::HysteresisSnapshot hysteresis;
+        if (has_hysteresis) {
+            HysteresisConfig config;
+            if (!in_.hysteresis(config) || !in_.pod(hysteresis.state) || !in_.pod(hysteresis.dwell)) return false;
+            hysteresis.config = config;
+            hysteresis_ = true;
+        }
+
+        std::uint32_t count = 0;
+        if (!in_.pod(count)) return false;
+
+        std::vector<BalanceMetrics> history(count);
+        for (auto& m : history) {
+            if (!in_.metrics(m)) return false;
+        }
+        balancer.restoreHistory(history.data(), history.size());
+        balancer.restoreHysteresis(hysteresis);
+#if !defined(SYNAPSE_CONSTEXPR_THRESHOLDS)
+        try {
+            thresholds.update(recorded);
+        } catch (const std::invalid_argument&) {
+            return false;  // Corrupt record: the recorder only sees published sets
+        }
+#else
+        (void)thresholds;
+#endif
+        return true;
+    }
+
+    bool readInput(TelemetryData& t, double& throttle) {
+        std::uint8_t flags = 0;
+        if (!in_.str(t.component_id) || !in_.time(t.timestamp)
+            || !in_.pod(t.cpu_usage) || !in_.pod(t.memory_usage)
+            || !in_.pod(t.io_latency_ms) || !in_.pod(t.network_latency_ms)
+            || !in_.pod(t.error_rate) || !in_.pod(t.throughput) || !in_.pod(flags)) {
+            return false;
+        }
+
+        t.temperature.reset();
+        t.power_consumption.reset();
+        double value = 0.0;
+        if (flags & 1) { if (!in_.pod(value)) return false; t.temperature = value; }
+        if (flags & 2) { if (!in_.pod(value)) return false; t.power_consumption = value; }
+        return in_.pod(throttle);
+    }
+
+public:
+    explicit BalanceReplayer(std::istream& in) : in_(in) {
+        char magic[sizeof(MAGIC)];
+        valid_ = static_cast<bool>(in.read(magic, sizeof(magic)))
+              && std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0
+              && in_.pod(version_) && version_ == FORMAT_VERSION
+              && in_.pod(target_throughput_);
+    }
+
+    bool valid() const { return valid_; }
+
+    /**
+     * Format version in the header (0 when there is no SYNAPSE header)
+     */
+    std::uint32_t version() const { return version_; }
+
+    std::chrono::system_clock::time_point now() override {
+        if (clock_.empty()) {
+            ++underruns_;
+            return last_clock_;
+        }
+        last_clock_ = clock_.front();
+        clock_.pop_front();
+        return last_clock_;
+    }
+
+    /**
+     * Replay the whole recording
+     *
+     * @param on_tick Called as on_tick(tick, recorded, replayed) per decision
+     */
+    template <typename Fn>
+    ReplayStats run(Fn&& on_tick) {
+        ReplayStats stats;
+        if (!valid_) return stats;
+
+        HardwareSoftwareBalancer balancer(target_throughput_);
+        ThresholdStore thresholds;
+        balancer.setThresholdStore(thresholds);
+        balancer.setClock(this);
+
+        TelemetryData telemetry;
+        double throttle = 1.0;
+        bool pending = false;
+        const auto started = std::chrono::steady_clock::now();
+
+        std::uint8_t tag = 0;
+        while (in_.pod(tag)) {
+            bool ok = true;
+            switch (tag) {
+                case TAG_STATE:
+                    ok = readState(balancer, thresholds);
+                    break;
+
+                case TAG_INPUT:
+                    ok = readInput(telemetry, throttle);
+                    pending = ok;
+                    clock_.clear();
+                    break;
+
+                case TAG_CLOCK: {
+                    std::chrono::system_clock::time_point t;
+                    ok = in_.time(t);
+                    if (ok) clock_.push_back(t);
+                    break;
+                }
+
+                case TAG_DECISION: {
+                    Decision recorded;
+                    ok = in_.decision(recorded) && pending;
+                    if (!ok) break;
+
+                    MitigationResult result = balancer.balance(telemetry, throttle);
+                    Decision replayed{result.action, result.throttle_level, result.imbalance};
+
+                    if (replayed != recorded) ++stats.mismatches;
+                    if (!clock_.empty()) ++stats.clock_overruns;
+                    on_tick(stats.ticks, recorded, replayed);
+
+                    ++stats.ticks;
+                    pending = false;
+                    break;
+                }
+
+                default:
+                    ok = false;
+                    break;
+            }
+
+            if (!ok) {
+                stats.truncated = true;
+                break;
+            }
+        }
+
+        stats.hysteresis = hysteresis_;
+        stats.clock_underruns = underruns_;
+        stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+        return stats;
+    }
+};
+
+} // namespace replay
+} // namespace neural
+} // namespace synapse
+
+#endif // SYNAPSE_BALANCE_REPLAY_HPP
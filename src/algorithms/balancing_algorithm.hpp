@@ -14,80 +14,197 @@
 #ifndef SYNAPSE_BALANCING_ALGORITHM_HPP
 #define SYNAPSE_BALANCING_ALGORITHM_HPP
 
+#if defined(SYNAPSE_EMBEDDED_PROFILE)
+#error "balancing_algorithm.hpp needs a hosted standard library; use embedded_balancer.hpp in SYNAPSE_EMBEDDED_PROFILE builds"
+#endif
+
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <deque>
 #include <vector>
 #include <chrono>
 #include <functional>
+#include <memory>
+#include <memory_resource>
 #include <optional>
+#include <stdexcept>
 #include <string>
 #include <mutex>
 #include <atomic>
 
+#include "balancing_types.hpp"
+#include "balancing_hysteresis.hpp"
+
 namespace synapse {
 namespace neural {
 
 // =============================================================================
-// CONSTANTS & THRESHOLDS
+// THRESHOLD STORE
 // =============================================================================
 
-struct Thresholds {
-    // IDI Thresholds
-    static constexpr double IDI_HEALTHY = 3.0;
-    static constexpr double IDI_WARNING = 5.0;
-    static constexpr double IDI_CRITICAL = 7.0;
-    static constexpr double IDI_QUARANTINE = 10.0;
-
-    // Hardware Constraints
-    static constexpr double CPU_WARNING = 70.0;
-    static constexpr double CPU_CRITICAL = 85.0;
-    static constexpr double CPU_EMERGENCY = 95.0;
-
-    static constexpr double MEMORY_WARNING = 75.0;
-    static constexpr double MEMORY_CRITICAL = 90.0;
-
-    static constexpr double TEMPERATURE_WARNING = 70.0;
-    static constexpr double TEMPERATURE_CRITICAL = 85.0;
-    static constexpr double TEMPERATURE_SHUTDOWN = 95.0;
-
-    // Balancing
-    static constexpr double HW_SW_IMBALANCE_THRESHOLD = 0.3;
-    static constexpr double LATENCY_WARNING_MS = 100.0;
-    static constexpr double LATENCY_CRITICAL_MS = 500.0;
-};
+#if defined(SYNAPSE_CONSTEXPR_THRESHOLDS)
 
-// =============================================================================
-// ENUMS
-// =============================================================================
+/**
+ * Threshold Store - compile-time mode
+ *
+ * Always serves DEFAULT_THRESHOLDS, so every threshold read folds into
+ * an immediate. No atomics, no heap; intended for embedded builds.
+ */
+class ThresholdStore {
+public:
+    const RuntimeThresholds* current() const { return &DEFAULT_THRESHOLDS; }
+    std::uint64_t version() const { return 0; }
 
-enum class SeverityLevel {
-    HEALTHY,
-    WARNING,
-    CRITICAL,
-    QUARANTINE
+    static const ThresholdStore& defaultStore() {
+        static const ThresholdStore store;
+        return store;
+    }
 };
 
-enum class MitigationAction {
-    NONE,
-    THROTTLE,
-    BRAKE,
-    QUARANTINE,
-    REBALANCE,
-    ALERT,
-    AUTO_INTEGRATE
-};
+#else
+
+/**
+ * Threshold Store - hot-reloadable thresholds (RCU style)
+ *
+ * Readers do a single acquire load of the current pointer per tick and
+ * never block. update() validates and publishes a new immutable version;
+ * superseded versions are parked until reclaim() is called from a
+ * quiescent point (no reader in flight), which is when they are actually
+ * freed.
+ *
+ * Readers hold no reference count, so reclaim() is only as safe as the
+ * caller's knowledge of its readers. For defaultStore() that means every
+ * thread in the process: the static IDICalculator/IDIBrake helpers, the
+ * C API and the Python module all read it without a balancer.
+ */
+class ThresholdStore {
+private:
+    std::atomic<const RuntimeThresholds*> current_;
+    std::unique_ptr<const RuntimeThresholds> owned_;
+    std::vector<std::unique_ptr<const RuntimeThresholds>> retired_;
+    std::mutex update_mutex_;
+
+public:
+    explicit ThresholdStore(const RuntimeThresholds& initial = DEFAULT_THRESHOLDS)
+        : owned_(std::make_unique<const RuntimeThresholds>(initial)) {
+        validate(*owned_);
+        current_.store(owned_.get(), std::memory_order_release);
+    }
+
+    ThresholdStore(const ThresholdStore&) = delete;
+    ThresholdStore& operator=(const ThresholdStore&) = delete;
 
-enum class ComponentType {
-    HARDWARE,
-    SOFTWARE,
-    FIRMWARE,
-    HYBRID
+    /**
+     * Hot-path read: one pointer load
+     */
+    const RuntimeThresholds* current() const {
+        return current_.load(std::memory_order_acquire);
+    }
+
+    std::uint64_t version() const { return current()->version; }
+
+    /**
+     * Reject a threshold set the balancer cannot use: non-finite values,
+     * tiers out of order (the IDI brake divides by their gaps) or an
+     * imbalance threshold outside (0, 1]
+     *
+     * Throws std::invalid_argument naming the first violation.
+     */
+    static void validate(const RuntimeThresholds& t) {
+        const double values[] = {
+            t.idi_healthy, t.idi_warning, t.idi_critical, t.idi_quarantine,
+            t.cpu_warning, t.cpu_critical, t.cpu_emergency,
+            t.memory_warning, t.memory_critical,
+            t.temperature_warning, t.temperature_critical, t.temperature_shutdown,
+            t.hw_sw_imbalance_threshold, t.latency_warning_ms, t.latency_critical_ms,
+        };
+        for (double v : values) {
+            if (!std::isfinite(v)) throw std::invalid_argument("thresholds: non-finite value");
+        }
+
+        auto ordered = [](double lower, double upper, const char* what) {
+            if (!(lower < upper)) throw std::invalid_argument(std::string("thresholds: ") + what);
+        };
+        ordered(0.0, t.idi_healthy, "idi_healthy must be positive");
+        ordered(t.idi_healthy, t.idi_warning, "idi_healthy must be below idi_warning");
+        ordered(t.idi_warning, t.idi_critical, "idi_warning must be below idi_critical");
+        ordered(t.idi_critical, t.idi_quarantine, "idi_critical must be below idi_quarantine");
+        ordered(t.cpu_warning, t.cpu_critical, "cpu_warning must be below cpu_critical");
+        ordered(t.cpu_critical, t.cpu_emergency, "cpu_critical must be below cpu_emergency");
+        ordered(t.memory_warning, t.memory_critical, "memory_warning must be below memory_critical");
+        ordered(t.temperature_warning, t.temperature_critical,
+                "temperature_warning must be below temperature_critical");
+        ordered(t.temperature_critical, t.temperature_shutdown,
+                "temperature_critical must be below temperature_shutdown");
+        ordered(t.latency_warning_ms, t.latency_critical_ms,
+                "latency_warning_ms must be below latency_critical_ms");
+        if (!(t.hw_sw_imbalance_threshold > 0.0 && t.hw_sw_imbalance_threshold <= 1.0)) {
+            throw std::invalid_argument("thresholds: hw_sw_imbalance_threshold must be in (0, 1]");
+        }
+    }
+
+    /**
+     * Publish new thresholds; picked up by the next balance() call
+     *
+     * The set is validated before the swap: on std::invalid_argument the
+     * current version stays published.
+     *
+     * @return Version number assigned to the new thresholds
+     */
+    std::uint64_t update(const RuntimeThresholds& next) {
+        validate(next);
+        std::lock_guard<std::mutex> lock(update_mutex_);
+
+        auto fresh = std::make_unique<RuntimeThresholds>(next);
+        fresh->version = owned_->version + 1;
+        std::uint64_t version = fresh->version;
+
+        current_.store(fresh.get(), std::memory_order_release);
+        retired_.push_back(std::move(owned_));
+        owned_ = std::move(fresh);
+        return version;
+    }
+
+    /**
+     * Free superseded versions
+     *
+     * Only call once every reader that may have loaded an old pointer has
+     * finished with it (e.g. from the ingest loop between batches). On
+     * defaultStore() that is a process-wide quiescent point: no thread may
+     * be inside a threshold-reading call, or it is left dangling.
+     */
+    void reclaim() {
+        std::lock_guard<std::mutex> lock(update_mutex_);
+        retired_.clear();
+    }
+
+    /**
+     * Process-wide store used by balancers that were not given one
+     *
+     * Also read by the static helpers' default arguments, so see
+     * reclaim() before freeing its old versions.
+     */
+    static ThresholdStore& defaultStore() {
+        static ThresholdStore store;
+        return store;
+    }
 };
 
+#endif // SYNAPSE_CONSTEXPR_THRESHOLDS
+
 // =============================================================================
 // DATA STRUCTURES
 // =============================================================================
 
+/**
+ * Dense integer handle for a registered component.
+ *
+ * Indexes and per-component tables use it instead of the string id.
+ */
+using ComponentHandle = std::uint32_t;
+
 struct TelemetryData {
     std::string component_id;
     std::chrono::system_clock::time_point timestamp;
@@ -122,6 +239,200 @@ struct BalanceMetrics {
     std::chrono::system_clock::time_point timestamp;
 };
 
+/**
+ * Timestamp of repeat `i` of `count` taken evenly over [first, last]
+ */
+inline std::chrono::system_clock::time_point repeatTimestamp(std::chrono::system_clock::time_point first,
+                                                             std::chrono::system_clock::time_point last,
+                                                             std::uint64_t i, std::uint64_t count) {
+    if (count < 2) return last;
+    const double fraction = static_cast<double>(i) / static_cast<double>(count - 1);
+    return first + std::chrono::duration_cast<std::chrono::system_clock::duration>((last - first) * fraction);
+}
+
+/**
+ * Receives every BalanceMetrics sample recorded by a balancer
+ *
+ * Called while the balancer holds its history lock, so implementations
+ * must be quick and must not call back into the balancer.
+ */
+class BalanceMetricsSink {
+public:
+    virtual ~BalanceMetricsSink() = default;
+    virtual void onBalanceMetrics(const BalanceMetrics& metrics) = 0;
+
+    /**
+     * `count` coalesced repeats of `metrics`, taken evenly over
+     * [first, last] (see HardwareSoftwareBalancer::repeatLast())
+     *
+     * The default forwards every repeat; sinks that see long runs should
+     * override it with an aggregate update.
+     */
+    virtual void onRepeatedMetrics(const BalanceMetrics& metrics, std::uint64_t count,
+                                   std::chrono::system_clock::time_point first,
+                                   std::chrono::system_clock::time_point last) {
+        BalanceMetrics repeat = metrics;
+        for (std::uint64_t i = 0; i < count; ++i) {
+            repeat.timestamp = repeatTimestamp(first, last, i, count);
+            onBalanceMetrics(repeat);
+        }
+    }
+};
+
+/**
+ * Injectable wall clock
+ *
+ * Balancers read time only through this interface when one is set, so
+ * record/replay and tests can control every clock read.
+ */
+class ClockSource {
+public:
+    virtual ~ClockSource() = default;
+    virtual std::chrono::system_clock::time_point now() = 0;
+};
+
+/**
+ * Allocation-free balancing decision
+ *
+ * The reason always points at a string literal, so the decision can be
+ * turned into any result type without touching the heap.
+ */
+struct BalancingDecision {
+    MitigationAction action;
+    double throttle_level;
+    const char* reason;
+};
+
+/**
+ * Immutable view of a balancer's recent metrics
+ *
+ * Published by HardwareSoftwareBalancer::publishSnapshot(); the data
+ * stays valid and unchanged for as long as the reader holds the pointer.
+ */
+class MetricsSnapshot {
+private:
+    std::vector<BalanceMetrics> metrics_;
+    std::uint64_t sequence_ = 0;
+
+    friend class HardwareSoftwareBalancer;
+
+public:
+    const BalanceMetrics* data() const { return metrics_.data(); }
+    size_t size() const { return metrics_.size(); }
+    bool empty() const { return metrics_.empty(); }
+
+    const BalanceMetrics* begin() const { return data(); }
+    const BalanceMetrics* end() const { return data() + size(); }
+
+    /**
+     * Publication counter, increases by one per publishSnapshot()
+     */
+    std::uint64_t sequence() const { return sequence_; }
+
+    /**
+     * Pointer to the newest `count` entries (zero-copy)
+     */
+    const BalanceMetrics* recent(size_t count) const {
+        return end() - std::min(count, size());
+    }
+};
+
+using MetricsSnapshotPtr = std::shared_ptr<const MetricsSnapshot>;
+
+// =============================================================================
+// ALLOCATOR-AWARE VARIANTS
+// =============================================================================
+
+namespace pmr {
+
+/**
+ * MitigationResult whose strings live in a caller-chosen memory resource
+ *
+ * Allocator-aware (uses-allocator construction), so a
+ * pmr::MitigationResults vector propagates its resource to every element.
+ */
+struct MitigationResult {
+    using allocator_type = std::pmr::polymorphic_allocator<char>;
+
+    MitigationAction action = MitigationAction::NONE;
+    std::pmr::string component_id;
+    std::pmr::string reason;
+    std::chrono::system_clock::time_point timestamp;
+
+    // Extended details
+    double idi_score = 0.0;
+    double throttle_level = 1.0;
+    double imbalance = 0.0;
+
+    MitigationResult() = default;
+    explicit MitigationResult(const allocator_type& alloc)
+        : component_id(alloc), reason(alloc) {}
+
+    MitigationResult(const MitigationResult&) = default;
+    MitigationResult(MitigationResult&&) = default;
+    MitigationResult& operator=(const MitigationResult&) = default;
+    MitigationResult& operator=(MitigationResult&&) = default;
+
+    MitigationResult(const MitigationResult& other, const allocator_type& alloc)
+        : action(other.action),
+          component_id(other.component_id, alloc),
+          reason(other.reason, alloc),
+          timestamp(other.timestamp),
+          idi_score(other.idi_score),
+          throttle_level(other.throttle_level),
+          imbalance(other.imbalance) {}
+
+    MitigationResult(MitigationResult&& other, const allocator_type& alloc)
+        : action(other.action),
+          component_id(std::move(other.component_id), alloc),
+          reason(std::move(other.reason), alloc),
+          timestamp(other.timestamp),
+          idi_score(other.idi_score),
+          throttle_level(other.throttle_level),
+          imbalance(other.imbalance) {}
+
+    allocator_type get_allocator() const { return component_id.get_allocator(); }
+};
+
+using MitigationResults = std::pmr::vector<MitigationResult>;
+using BalanceMetricsList = std::pmr::vector<BalanceMetrics>;
+
+} // namespace pmr
+
+/**
+ * Per-tick monotonic arena
+ *
+ * Bump-allocates out of one preallocated buffer; reset() rewinds it in
+ * O(1) as long as the tick stayed within the buffer. Overflow spills to
+ * the upstream resource and is returned on the next reset(). Use it for
+ * per-tick results, never for state that outlives the tick (such as the
+ * balancer history - give that a pool resource instead).
+ */
+class TickArena {
+private:
+    std::unique_ptr<std::byte[]> buffer_;
+    size_t capacity_;
+    std::pmr::monotonic_buffer_resource resource_;
+
+public:
+    explicit TickArena(size_t capacity = 64 * 1024,
+                       std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+        : buffer_(new std::byte[capacity]),
+          capacity_(capacity),
+          resource_(buffer_.get(), capacity, upstream) {}
+
+    TickArena(const TickArena&) = delete;
+    TickArena& operator=(const TickArena&) = delete;
+
+    std::pmr::memory_resource* resource() { return &resource_; }
+    size_t capacity() const { return capacity_; }
+
+    /**
+     * Release everything allocated since the last reset
+     */
+    void reset() { resource_.release(); }
+};
+
 // =============================================================================
 // IDI CALCULATOR
 // =============================================================================
@@ -141,10 +452,11 @@ public:
         return d * l * dep;
     }
 
-    static SeverityLevel getSeverity(double idi) {
-        if (idi < Thresholds::IDI_HEALTHY) return SeverityLevel::HEALTHY;
-        if (idi < Thresholds::IDI_WARNING) return SeverityLevel::WARNING;
-        if (idi < Thresholds::IDI_QUARANTINE) return SeverityLevel::CRITICAL;
+    static SeverityLevel getSeverity(double idi,
+                                     const RuntimeThresholds& thresholds = *ThresholdStore::defaultStore().current()) {
+        if (idi < thresholds.idi_healthy) return SeverityLevel::HEALTHY;
+        if (idi < thresholds.idi_warning) return SeverityLevel::WARNING;
+        if (idi < thresholds.idi_quarantine) return SeverityLevel::CRITICAL;
         return SeverityLevel::QUARANTINE;
     }
 
@@ -216,6 +528,26 @@ public:
         // Clamp to reasonable range
         return std::clamp(adjustment, -0.3, 0.3);
     }
+
+    /**
+     * Equivalent of calling calculate(current_value) `ticks` times in a row
+     *
+     * O(1): with a constant input the integral moves monotonically, so it
+     * can be advanced in one clamped step and the derivative is zero
+     * after the first tick. Returns the last adjustment.
+     */
+    double calculateRepeated(double current_value, size_t ticks) {
+        if (ticks == 0) return 0.0;
+        if (ticks == 1) return calculate(current_value);
+
+        double error = target_ - current_value;
+        integral_ = std::clamp(integral_ + error * static_cast<double>(ticks),
+                               INTEGRAL_MIN, INTEGRAL_MAX);
+        previous_error_ = error;
+
+        double adjustment = (kp_ * error + ki_ * integral_) / 100.0;
+        return std::clamp(adjustment, -0.3, 0.3);
+    }
 };
 
 // =============================================================================
@@ -232,15 +564,229 @@ public:
  */
 class HardwareSoftwareBalancer {
 private:
-    std::deque<BalanceMetrics> history_;
+    std::pmr::deque<BalanceMetrics> history_;
     const size_t moving_avg_window_ = 10;
     mutable std::mutex mutex_;
 
     double target_throughput_;
+    const ThresholdStore* thresholds_ = &ThresholdStore::defaultStore();
+    BalanceMetricsSink* sink_ = nullptr;
+    ClockSource* clock_ = nullptr;
+
+    // Bumped by every change to decision state outside a balancing tick
+    std::atomic<std::uint64_t> state_generation_{0};
+
+    void stateChanged() { state_generation_.fetch_add(1, std::memory_order_release); }
+
+    // Double-buffered snapshots: readers only ever atomic_load published_
+    MetricsSnapshotPtr published_;
+    std::shared_ptr<MetricsSnapshot> snapshot_buffers_[2];
+    std::uint64_t snapshot_sequence_ = 0;
+
+    // Optional enter/exit state machine, guarded by mutex_ and advanced
+    // only by balancing ticks
+    std::optional<HysteresisConfig> hysteresis_;
+    std::uint8_t hysteresis_state_ = 0;
+    std::uint16_t hysteresis_dwell_ = 0;
+
+    static BalancingDecision hysteresisDecision(std::uint8_t state, double throttle) {
+        switch (static_cast<BalanceState>(state)) {
+            case BalanceState::THROTTLING:
+                return {MitigationAction::THROTTLE, throttle, "Hardware overloaded - throttling software"};
+            case BalanceState::BOOSTING:
+                return {MitigationAction::ALERT, throttle, "Hardware underutilized - boost potential available"};
+            default:
+                return {MitigationAction::NONE, throttle, "System is balanced"};
+        }
+    }
+
+    /**
+     * decide(), or one hysteresis tick when enabled (mutex_ held)
+     */
+    BalancingDecision decideTickLocked(double imbalance, double current_throttle,
+                                       const RuntimeThresholds& thresholds) {
+        if (!hysteresis_) return decide(imbalance, current_throttle, thresholds);
+
+        double throttle = hysteresisStep(*hysteresis_, hysteresis_state_, hysteresis_dwell_,
+                                         imbalance, current_throttle);
+        return hysteresisDecision(hysteresis_state_, throttle);
+    }
+
+    /**
+     * Push metrics to history, smooth, and take one decision tick
+     */
+    BalancingDecision recordAndDecide(double hw_capacity, double sw_demand, double imbalance,
+                                      double current_throttle, const RuntimeThresholds& thresholds,
+                                      double& avg_imbalance) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        avg_imbalance = recordAndSmoothLocked(hw_capacity, sw_demand, imbalance);
+        return decideTickLocked(avg_imbalance, current_throttle, thresholds);
+    }
+
+    /**
+     * Push metrics to history and return the smoothed imbalance (mutex_ held)
+     */
+    double recordAndSmoothLocked(double hw_capacity, double sw_demand, double imbalance) {
+        history_.push_back({
+            hw_capacity,
+            sw_demand,
+            imbalance,
+            now()
+        });
+
+        if (sink_) sink_->onBalanceMetrics(history_.back());
+
+        // Keep history bounded
+        while (history_.size() > moving_avg_window_ * 2) {
+            history_.pop_front();
+        }
+
+        // Calculate smoothed imbalance (moving average)
+        if (history_.size() < moving_avg_window_) return imbalance;
+
+        double sum = 0.0;
+        auto it = history_.end();
+        std::advance(it, -static_cast<int>(moving_avg_window_));
+        for (; it != history_.end(); ++it) {
+            sum += it->imbalance;
+        }
+        return sum / moving_avg_window_;
+    }
+
+    BalancingDecision balanceTick(const TelemetryData& telemetry, double current_throttle,
+                                  const RuntimeThresholds& thresholds, double& avg_imbalance) {
+        double hw_capacity = calculateHardwareCapacity(telemetry, thresholds);
+        double sw_demand = calculateSoftwareDemand(telemetry, thresholds);
+        double imbalance = calculateImbalance(hw_capacity, sw_demand);
+        return recordAndDecide(hw_capacity, sw_demand, imbalance, current_throttle, thresholds, avg_imbalance);
+    }
 
 public:
     explicit HardwareSoftwareBalancer(double target_throughput = 1000.0)
-        : target_throughput_(target_throughput) {}
+        : target_throughput_(target_throughput),
+          published_(std::make_shared<const MetricsSnapshot>()) {}
+
+    /**
+     * @param resource Memory resource backing the history (a pool resource
+     *                 keeps long-running daemons from fragmenting)
+     */
+    HardwareSoftwareBalancer(double target_throughput, std::pmr::memory_resource* resource)
+        : history_(resource), target_throughput_(target_throughput),
+          published_(std::make_shared<const MetricsSnapshot>()) {}
+
+    /**
+     * Use a dedicated threshold store (set before ingestion starts)
+     */
+    void setThresholdStore(const ThresholdStore& store) {
+        thresholds_ = &store;
+        stateChanged();
+    }
+
+    /**
+     * Forward every recorded sample to a sink (nullptr to detach)
+     */
+    void setMetricsSink(BalanceMetricsSink* sink) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        sink_ = sink;
+    }
+
+    /**
+     * Read time from `clock` instead of the system clock (nullptr = system)
+     */
+    void setClock(ClockSource* clock) { clock_ = clock; }
+
+    /**
+     * Time from the balancer's clock, as balance() stamps history with
+     */
+    std::chrono::system_clock::time_point now() const {
+        return clock_ ? clock_->now() : std::chrono::system_clock::now();
+    }
+
+    double targetThroughput() const { return target_throughput_; }
+
+    /**
+     * Use separate enter/exit thresholds and a minimum dwell time
+     *
+     * The config's thresholds replace hw_sw_imbalance_threshold while
+     * enabled. The state advances under the balancer's lock on every
+     * balance() / balanceDecision() tick; getBalancingAction() only
+     * evaluates the next tick.
+     */
+    void setHysteresis(const HysteresisConfig& config) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        hysteresis_ = config;
+        hysteresis_state_ = 0;
+        hysteresis_dwell_ = 0;
+        stateChanged();
+    }
+
+    void clearHysteresis() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        hysteresis_.reset();
+        stateChanged();
+    }
+
+    std::optional<HysteresisConfig> hysteresis() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return hysteresis_;
+    }
+
+    /**
+     * Hysteresis state (BALANCED while hysteresis is off)
+     */
+    BalanceState balanceState() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return hysteresis_ ? static_cast<BalanceState>(hysteresis_state_) : BalanceState::BALANCED;
+    }
+
+    /**
+     * Hysteresis config and state, for recorded state snapshots
+     */
+    struct HysteresisSnapshot {
+        std::optional<HysteresisConfig> config;    // nullopt while hysteresis is off
+        std::uint8_t state = 0;
+        std::uint16_t dwell = 0;
+    };
+
+    HysteresisSnapshot hysteresisSnapshot() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return {hysteresis_, hysteresis_state_, hysteresis_dwell_};
+    }
+
+    /**
+     * Replace the hysteresis config and state (restoring a recorded state snapshot)
+     */
+    void restoreHysteresis(const HysteresisSnapshot& snapshot) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        hysteresis_ = snapshot.config;
+        hysteresis_state_ = snapshot.config ? snapshot.state : 0;
+        hysteresis_dwell_ = snapshot.config ? snapshot.dwell : 0;
+        stateChanged();
+    }
+
+    /**
+     * Replace the history (restoring a recorded state snapshot)
+     */
+    void restoreHistory(const BalanceMetrics* metrics, size_t count) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        history_.assign(metrics, metrics + count);
+        while (history_.size() > moving_avg_window_ * 2) {
+            history_.pop_front();
+        }
+        stateChanged();
+    }
+
+    /**
+     * Changes whenever history, hysteresis or the threshold store change
+     * other than by a balancing tick (restore*(), setHysteresis(),
+     * repeatLast(), ...), so a recorder can snapshot them
+     */
+    std::uint64_t stateGeneration() const { return state_generation_.load(std::memory_order_acquire); }
+
+    /**
+     * Thresholds in effect for the next tick
+     */
+    const RuntimeThresholds& thresholds() const { return *thresholds_->current(); }
 
     /**
      * Calculate hardware capacity score (0-100)
@@ -248,6 +794,11 @@ public:
      * Higher score = more capacity available
      */
     double calculateHardwareCapacity(const TelemetryData& telemetry) const {
+        return calculateHardwareCapacity(telemetry, thresholds());
+    }
+
+    double calculateHardwareCapacity(const TelemetryData& telemetry,
+                                     const RuntimeThresholds& thresholds) const {
         // CPU capacity (inverse)
         double cpu_capacity = 100.0 - telemetry.cpu_usage;
 
@@ -258,9 +809,9 @@ public:
         double temp_factor = 1.0;
         if (telemetry.temperature.has_value()) {
             double temp = telemetry.temperature.value();
-            if (temp > Thresholds::TEMPERATURE_CRITICAL) {
+            if (temp > thresholds.temperature_critical) {
                 temp_factor = 0.3;
-            } else if (temp > Thresholds::TEMPERATURE_WARNING) {
+            } else if (temp > thresholds.temperature_warning) {
                 temp_factor = 0.7;
             }
         }
@@ -275,18 +826,23 @@ public:
      * Higher score = more resources demanded
      */
     double calculateSoftwareDemand(const TelemetryData& telemetry) const {
+        return calculateSoftwareDemand(telemetry, thresholds());
+    }
+
+    double calculateSoftwareDemand(const TelemetryData& telemetry,
+                                   const RuntimeThresholds& thresholds) const {
         // Throughput-based demand
         double throughput_demand = std::min(
             (telemetry.throughput / target_throughput_) * 100.0, 100.0);
 
         // Latency-based urgency
         double latency_urgency;
-        if (telemetry.io_latency_ms > Thresholds::LATENCY_CRITICAL_MS) {
+        if (telemetry.io_latency_ms > thresholds.latency_critical_ms) {
             latency_urgency = 100.0;
-        } else if (telemetry.io_latency_ms > Thresholds::LATENCY_WARNING_MS) {
+        } else if (telemetry.io_latency_ms > thresholds.latency_warning_ms) {
             latency_urgency = 70.0;
         } else {
-            latency_urgency = (telemetry.io_latency_ms / Thresholds::LATENCY_WARNING_MS) * 50.0;
+            latency_urgency = (telemetry.io_latency_ms / thresholds.latency_warning_ms) * 50.0;
         }
 
         // Error rate-based stress
@@ -309,42 +865,65 @@ public:
     }
 
     /**
-     * Get balancing action based on imbalance
+     * Decide the balancing action without building a result object
      */
-    MitigationResult getBalancingAction(double imbalance,
-                                         const std::string& component_id,
-                                         double current_throttle) const {
-        MitigationResult result;
-        result.component_id = component_id;
-        result.timestamp = std::chrono::system_clock::now();
-        result.imbalance = imbalance;
+    BalancingDecision decide(double imbalance, double current_throttle) const {
+        return decide(imbalance, current_throttle, thresholds());
+    }
 
-        const double threshold = Thresholds::HW_SW_IMBALANCE_THRESHOLD;
+    BalancingDecision decide(double imbalance, double current_throttle,
+                             const RuntimeThresholds& thresholds) const {
+        const double threshold = thresholds.hw_sw_imbalance_threshold;
 
         if (std::abs(imbalance) < threshold) {
             // Balanced
-            result.action = MitigationAction::NONE;
-            result.reason = "System is balanced";
-            result.throttle_level = current_throttle;
+            return {MitigationAction::NONE, current_throttle, "System is balanced"};
         }
-        else if (imbalance < -threshold) {
+
+        if (imbalance < -threshold) {
             // Hardware overloaded - throttle software
             double throttle_amount = std::min(std::abs(imbalance), 0.5);
             double new_throttle = std::max(current_throttle - throttle_amount, 0.2);
 
-            result.action = MitigationAction::THROTTLE;
-            result.reason = "Hardware overloaded - throttling software";
-            result.throttle_level = new_throttle;
+            return {MitigationAction::THROTTLE, new_throttle,
+                    "Hardware overloaded - throttling software"};
         }
-        else {
-            // Hardware underutilized - can boost
-            double boost_potential = std::min(imbalance, 0.3);
 
-            result.action = MitigationAction::ALERT;
-            result.reason = "Hardware underutilized - boost potential available";
-            result.throttle_level = std::min(current_throttle + boost_potential, 1.0);
+        // Hardware underutilized - can boost
+        double boost_potential = std::min(imbalance, 0.3);
+
+        return {MitigationAction::ALERT, std::min(current_throttle + boost_potential, 1.0),
+                "Hardware underutilized - boost potential available"};
+    }
+
+    /**
+     * Get balancing action based on imbalance
+     *
+     * A query: with hysteresis it reports what the next tick would do
+     * from the current state without advancing it.
+     */
+    MitigationResult getBalancingAction(double imbalance,
+                                         const std::string& component_id,
+                                         double current_throttle) const {
+        BalancingDecision decision = decide(imbalance, current_throttle, thresholds());
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (hysteresis_) {
+                std::uint8_t state = hysteresis_state_;
+                std::uint16_t dwell = hysteresis_dwell_;
+                double throttle = hysteresisStep(*hysteresis_, state, dwell, imbalance, current_throttle);
+                decision = hysteresisDecision(state, throttle);
+            }
         }
 
+        MitigationResult result;
+        result.component_id = component_id;
+        result.timestamp = now();
+        result.imbalance = imbalance;
+        result.action = decision.action;
+        result.reason = decision.reason;
+        result.throttle_level = decision.throttle_level;
+
         return result;
     }
 
@@ -352,60 +931,170 @@ public:
      * Main balancing function - call on each telemetry update
      */
     MitigationResult balance(const TelemetryData& telemetry, double current_throttle) {
-        double hw_capacity = calculateHardwareCapacity(telemetry);
-        double sw_demand = calculateSoftwareDemand(telemetry);
-        double imbalance = calculateImbalance(hw_capacity, sw_demand);
+        double avg_imbalance = 0.0;
+        BalancingDecision decision = balanceTick(telemetry, current_throttle, thresholds(), avg_imbalance);
 
-        // Record to history
-        {
-            std::lock_guard<std::mutex> lock(mutex_);
-            history_.push_back({
-                hw_capacity,
-                sw_demand,
-                imbalance,
-                std::chrono::system_clock::now()
-            });
-
-            // Keep history bounded
-            while (history_.size() > moving_avg_window_ * 2) {
-                history_.pop_front();
-            }
+        MitigationResult result;
+        result.component_id = telemetry.component_id;
+        result.timestamp = now();
+        result.imbalance = avg_imbalance;
+        result.action = decision.action;
+        result.reason = decision.reason;
+        result.throttle_level = decision.throttle_level;
+
+        return result;
+    }
+
+    /**
+     * Balance without building a result object (batch / FFI paths)
+     *
+     * @param smoothed_imbalance Receives the moving-average imbalance if non-null
+     */
+    BalancingDecision balanceDecision(const TelemetryData& telemetry, double current_throttle,
+                                      double* smoothed_imbalance = nullptr) {
+        double avg_imbalance = 0.0;
+        BalancingDecision decision = balanceTick(telemetry, current_throttle, thresholds(), avg_imbalance);
+        if (smoothed_imbalance) *smoothed_imbalance = avg_imbalance;
+        return decision;
+    }
+
+    /**
+     * Balance and append the result to an allocator-aware container
+     *
+     * The result's strings come from the container's memory resource
+     * (typically a TickArena), so the call never touches the global heap
+     * once the container has capacity.
+     */
+    pmr::MitigationResult& balance(const TelemetryData& telemetry,
+                                   double current_throttle,
+                                   pmr::MitigationResults& out) {
+        double avg_imbalance = 0.0;
+        BalancingDecision decision = balanceTick(telemetry, current_throttle, thresholds(), avg_imbalance);
+
+        pmr::MitigationResult& result = out.emplace_back();
+        result.component_id = telemetry.component_id;
+        result.timestamp = now();
+        result.imbalance = avg_imbalance;
+        result.action = decision.action;
+        result.reason = decision.reason;
+        result.throttle_level = decision.throttle_level;
+
+        return result;
+    }
+
+    /**
+     * Record `ticks` more copies of the newest sample without re-scoring
+     *
+     * Used by ingestion filters that coalesce unchanged telemetry; the
+     * ticks are taken to be evenly spaced over [first, last]. Only the
+     * last 2 x window entries are observable, so this costs at most that
+     * many pushes however long the run was, and the metrics sink gets the
+     * whole run in one onRepeatedMetrics() call. Coalesced ticks are
+     * fixed points that keep the hysteresis state, so its dwell advances
+     * by `ticks` (saturating like hysteresisAdvance()).
+     */
+    void repeatLast(size_t ticks, std::chrono::system_clock::time_point first,
+                    std::chrono::system_clock::time_point last) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (history_.empty() || ticks == 0) return;
+        stateChanged();
+
+        if (hysteresis_) {
+            hysteresis_dwell_ = static_cast<std::uint16_t>(
+                std::min<size_t>(0xFFFF - hysteresis_dwell_, ticks) + hysteresis_dwell_);
         }
 
-        // Calculate smoothed imbalance (moving average)
-        double avg_imbalance = imbalance;
-        {
-            std::lock_guard<std::mutex> lock(mutex_);
-            if (history_.size() >= moving_avg_window_) {
-                double sum = 0.0;
-                auto it = history_.end();
-                std::advance(it, -static_cast<int>(moving_avg_window_));
-                for (; it != history_.end(); ++it) {
-                    sum += it->imbalance;
-                }
-                avg_imbalance = sum / moving_avg_window_;
-            }
+        BalanceMetrics repeat = history_.back();
+        if (sink_) sink_->onRepeatedMetrics(repeat, ticks, first, last);
+
+        const size_t n = std::min(ticks, moving_avg_window_ * 2);
+        for (size_t i = ticks - n; i < ticks; ++i) {
+            repeat.timestamp = repeatTimestamp(first, last, i, ticks);
+            history_.push_back(repeat);
         }
+        while (history_.size() > moving_avg_window_ * 2) {
+            history_.pop_front();
+        }
+    }
 
-        return getBalancingAction(avg_imbalance, telemetry.component_id, current_throttle);
+    /**
+     * repeatLast() for a run that ends now
+     */
+    void repeatLast(size_t ticks) {
+        auto t = now();
+        repeatLast(ticks, t, t);
     }
 
+    size_t movingAverageWindow() const { return moving_avg_window_; }
+
     /**
      * Get recent balance metrics
      */
     std::vector<BalanceMetrics> getRecentMetrics(size_t count = 10) const {
         std::lock_guard<std::mutex> lock(mutex_);
-        std::vector<BalanceMetrics> result;
+        auto start = history_.size() > count
+            ? history_.end() - count
+            : history_.begin();
+
+        return std::vector<BalanceMetrics>(start, history_.end());
+    }
 
+    /**
+     * Get recent balance metrics into a caller-chosen memory resource
+     */
+    pmr::BalanceMetricsList getRecentMetrics(size_t count, std::pmr::memory_resource* resource) const {
+        std::lock_guard<std::mutex> lock(mutex_);
         auto start = history_.size() > count
             ? history_.end() - count
             : history_.begin();
 
-        for (auto it = start; it != history_.end(); ++it) {
-            result.push_back(*it);
+        return pmr::BalanceMetricsList(start, history_.end(), resource);
+    }
+
+    /**
+     * Publish the current history for lock-free readers
+     *
+     * Call once per tick from the ingestion side. Alternates between two
+     * buffers and only allocates when a reader still holds the inactive
+     * one, so steady-state publishing copies the history and nothing else.
+     */
+    void publishSnapshot() {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        std::shared_ptr<MetricsSnapshot> next;
+        for (auto& buffer : snapshot_buffers_) {
+            if (buffer && buffer.get() != published_.get() && buffer.use_count() == 1) {
+                next = buffer;
+                break;
+            }
+        }
+
+        if (next) {
+            // Pair with the readers' release of their last reference
+            std::atomic_thread_fence(std::memory_order_acquire);
+        } else {
+            next = std::make_shared<MetricsSnapshot>();
+            auto& slot = snapshot_buffers_[0].get() == published_.get()
+                ? snapshot_buffers_[1]
+                : snapshot_buffers_[0];
+            slot = next;
         }
 
-        return result;
+        next->metrics_.assign(history_.begin(), history_.end());
+        next->sequence_ = ++snapshot_sequence_;
+
+        std::atomic_store_explicit(&published_, MetricsSnapshotPtr(next),
+                                   std::memory_order_release);
+    }
+
+    /**
+     * Latest published snapshot - never blocks on balance()
+     *
+     * Readers may hold the pointer as long as they like; the writer
+     * simply stops recycling that buffer until it is released.
+     */
+    MetricsSnapshotPtr snapshot() const {
+        return std::atomic_load_explicit(&published_, std::memory_order_acquire);
     }
 };
 
@@ -427,29 +1116,30 @@ public:
      * @param idi Integration Debt Index value
      * @return Throttle level (0.0 = stopped, 1.0 = full speed)
      */
-    static double calculateThrottleLevel(double idi) {
-        if (idi < Thresholds::IDI_HEALTHY) {
+    static double calculateThrottleLevel(double idi,
+                                         const RuntimeThresholds& thresholds = *ThresholdStore::defaultStore().current()) {
+        if (idi < thresholds.idi_healthy) {
             return 1.0;  // Full speed
         }
 
-        if (idi < Thresholds::IDI_WARNING) {
+        if (idi < thresholds.idi_warning) {
             // Linear slowdown from 1.0 to 0.7
-            double ratio = (idi - Thresholds::IDI_HEALTHY) /
-                          (Thresholds::IDI_WARNING - Thresholds::IDI_HEALTHY);
+            double ratio = (idi - thresholds.idi_healthy) /
+                          (thresholds.idi_warning - thresholds.idi_healthy);
             return 1.0 - (ratio * 0.3);
         }
 
-        if (idi < Thresholds::IDI_CRITICAL) {
+        if (idi < thresholds.idi_critical) {
             // Aggressive slowdown from 0.7 to 0.3
-            double ratio = (idi - Thresholds::IDI_WARNING) /
-                          (Thresholds::IDI_CRITICAL - Thresholds::IDI_WARNING);
+            double ratio = (idi - thresholds.idi_warning) /
+                          (thresholds.idi_critical - thresholds.idi_warning);
             return 0.7 - (ratio * 0.4);
         }
 
-        if (idi < Thresholds::IDI_QUARANTINE) {
+        if (idi < thresholds.idi_quarantine) {
             // Near stop from 0.3 to 0.1
-            double ratio = (idi - Thresholds::IDI_CRITICAL) /
-                          (Thresholds::IDI_QUARANTINE - Thresholds::IDI_CRITICAL);
+            double ratio = (idi - thresholds.idi_critical) /
+                          (thresholds.idi_quarantine - thresholds.idi_critical);
             return 0.3 - (ratio * 0.2);
         }
 
@@ -463,14 +1153,15 @@ public:
                                         double idi,
                                         int days_since_integration,
                                         int loc_changed,
-                                        int dependencies) {
+                                        int dependencies,
+                                        const RuntimeThresholds& thresholds = *ThresholdStore::defaultStore().current()) {
         MitigationResult result;
         result.component_id = component_id;
         result.timestamp = std::chrono::system_clock::now();
         result.idi_score = idi;
 
-        SeverityLevel severity = IDICalculator::getSeverity(idi);
-        double throttle = calculateThrottleLevel(idi);
+        SeverityLevel severity = IDICalculator::getSeverity(idi, thresholds);
+        double throttle = calculateThrottleLevel(idi, thresholds);
         result.throttle_level = throttle;
 
         switch (severity) {
@@ -525,16 +1216,17 @@ public:
     static bool shouldPrune(double idi,
                            double error_rate,
                            double health_score,
-                           std::optional<double> temperature = std::nullopt) {
+                           std::optional<double> temperature = std::nullopt,
+                           const RuntimeThresholds& thresholds = *ThresholdStore::defaultStore().current()) {
         // IDI check
-        if (idi >= Thresholds::IDI_QUARANTINE) return true;
+        if (idi >= thresholds.idi_quarantine) return true;
 
         // Error rate check
         if (error_rate >= 0.05) return true;  // 5% error rate
 
         // Temperature check (for hardware)
         if (temperature.has_value() &&
-            temperature.value() >= Thresholds::TEMPERATURE_SHUTDOWN) {
+            temperature.value() >= thresholds.temperature_shutdown) {
             return true;
         }
 
@@ -549,9 +1241,10 @@ public:
      */
     static bool canRestore(double idi,
                           double health_score,
-                          std::chrono::system_clock::time_point quarantined_at) {
+                          std::chrono::system_clock::time_point quarantined_at,
+                          const RuntimeThresholds& thresholds = *ThresholdStore::defaultStore().current()) {
         // IDI must be below warning
-        if (idi >= Thresholds::IDI_WARNING) return false;
+        if (idi >= thresholds.idi_warning) return false;
 
         // Health must be above 70
         if (health_score < 70.0) return false;
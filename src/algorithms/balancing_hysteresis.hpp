@@ -0,0 +1,225 @@
+/**
+ * SYNAPSE Neural Connection Layer - Balancing Hysteresis
+ * ======================================================
+ *
+ * Optional state machine in front of the balancing decision. decide()
+ * compares |imbalance| with one threshold, so a component hovering at
+ * ±0.3 flips THROTTLE / NONE / ALERT every tick. Here each state has an
+ * enter and a (smaller) exit threshold plus a minimum dwell time:
+ *
+ *                imbalance <= -throttle_enter
+ *   BALANCED  ------------------------------->  THROTTLING
+ *             <-------------------------------
+ *                imbalance > -throttle_exit
+ *                and dwell >= min_dwell_ticks
+ *
+ * and symmetrically for BOOSTING (boost_enter / boost_exit). BALANCED
+ * is left as soon as an enter threshold is crossed; the dwell only keeps
+ * a throttle or boost from being dropped too early. With
+ * enter == exit and min_dwell_ticks == 0 it makes the same decisions as
+ * decide(), except that imbalance == -threshold exactly counts as
+ * THROTTLING (decide() reports it as ALERT).
+ *
+ * Per-component state is one byte of state plus a 16-bit dwell counter,
+ * stored as separate arrays in HysteresisStates so stepBatch() is a
+ * branch-free loop the compiler can vectorize.
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#ifndef SYNAPSE_BALANCING_HYSTERESIS_HPP
+#define SYNAPSE_BALANCING_HYSTERESIS_HPP
+
+#include "balancing_types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace synapse {
+namespace neural {
+
+enum class BalanceState : std::uint8_t {
+    BALANCED = 0,
+    THROTTLING = 1,
+    BOOSTING = 2
+};
+
+inline MitigationAction toAction(BalanceState state) {
+    switch (state) {
+        case BalanceState::THROTTLING: return MitigationAction::THROTTLE;
+        case BalanceState::BOOSTING: return MitigationAction::ALERT;
+        default: return MitigationAction::NONE;
+    }
+}
+
+struct HysteresisConfig {
+    double throttle_enter = Thresholds::HW_SW_IMBALANCE_THRESHOLD;   // imbalance <= -enter
+    double throttle_exit = 0.2;                                      // leave once > -exit
+    double boost_enter = Thresholds::HW_SW_IMBALANCE_THRESHOLD;      // imbalance >= enter
+    double boost_exit = 0.2;                                         // leave once < exit
+    std::uint16_t min_dwell_ticks = 3;                               // ticks before THROTTLING / BOOSTING may be left
+};
+
+// =============================================================================
+// STEP KERNEL
+// =============================================================================
+
+/**
+ * Advance one component's state by one tick
+ *
+ * Branch-free (bit arithmetic, no ?: on the integers, which GCC would
+ * turn back into branches) so it inlines into a vectorizable loop.
+ *
+ * @param state In/out: current state (as its underlying byte)
+ * @param dwell In/out: ticks spent in the current state (saturating)
+ * @return The new state
+ */
+inline std::uint8_t hysteresisAdvance(const HysteresisConfig& c, std::uint8_t& state,
+                                      std::uint16_t& dwell, double imbalance) {
+    constexpr std::uint8_t THROTTLING = static_cast<std::uint8_t>(BalanceState::THROTTLING);
+    constexpr std::uint8_t BOOSTING = static_cast<std::uint8_t>(BalanceState::BOOSTING);
+
+    const std::uint8_t s = state;
+    const std::uint16_t d = dwell;
+
+    // Where the single-threshold rule would go, unless the current state
+    // still holds (the two holds are exclusive)
+    const bool enter_throttle = imbalance <= -c.throttle_enter;
+    const bool enter_boost = imbalance >= c.boost_enter;
+    const bool hold_throttle = (s == THROTTLING) & (imbalance <= -c.throttle_exit);
+    const bool hold_boost = (s == BOOSTING) & (imbalance >= c.boost_exit);
+    const bool to_throttle = hold_throttle | (!hold_boost & enter_throttle);
+    const bool to_boost = hold_boost | (!hold_throttle & !enter_throttle & enter_boost);
+    const auto target = static_cast<std::uint8_t>(to_throttle * THROTTLING + to_boost * BOOSTING);
+
+    // The dwell only holds THROTTLING / BOOSTING; BALANCED reacts at once
+    const bool may_leave = (s == 0) | (d >= c.min_dwell_ticks);
+    const auto next = static_cast<std::uint8_t>(s + may_leave * (target - s));
+    const bool stays = next == s;
+    state = next;
+    dwell = static_cast<std::uint16_t>((d + (d != 0xFFFF)) & -static_cast<int>(stays));
+    return next;
+}
+
+/**
+ * Throttle level for a state, with the same formulas as decide()
+ *
+ * Steps are clamped at 0 so a state held against the sign of the
+ * imbalance keeps the throttle instead of reversing it. The step limits
+ * are applied to the result (cur - min(m, 0.5) == max(cur - m, cur - 0.5),
+ * exactly) and spelled as ?: so that GCC if-converts the loop; with
+ * std::min / std::max it branches.
+ */
+inline double hysteresisThrottle(std::uint8_t state, double imbalance, double current_throttle) {
+    const double floor_down = current_throttle - 0.5;
+    const double ceiling_up = current_throttle + 0.3;
+
+    double down = current_throttle + (imbalance > 0.0 ? 0.0 : imbalance);
+    down = down < floor_down ? floor_down : down;
+    down = down < 0.2 ? 0.2 : down;
+
+    double up = current_throttle + (imbalance < 0.0 ? 0.0 : imbalance);
+    up = up > ceiling_up ? ceiling_up : up;
+    up = up > 1.0 ? 1.0 : up;
+
+    return state == static_cast<std::uint8_t>(BalanceState::THROTTLING) ? down
+         : state == static_cast<std::uint8_t>(BalanceState::BOOSTING) ? up
+         : current_throttle;
+}
+
+/**
+ * Advance one component by one tick
+ *
+ * @return New throttle level for the state entered or held
+ */
+inline double hysteresisStep(const HysteresisConfig& c, std::uint8_t& state, std::uint16_t& dwell,
+                             double imbalance, double current_throttle) {
+    return hysteresisThrottle(hysteresisAdvance(c, state, dwell, imbalance), imbalance, current_throttle);
+}
+
+// =============================================================================
+// PER-COMPONENT STATE (SoA)
+// =============================================================================
+
+/**
+ * Hysteresis state for a set of components, indexed 0..size()-1
+ */
+class HysteresisStates {
+private:
+    HysteresisConfig config_;
+    std::vector<std::uint8_t> state_;
+    std::vector<std::uint16_t> dwell_;
+
+public:
+    explicit HysteresisStates(const HysteresisConfig& config = HysteresisConfig{}, size_t count = 0)
+        : config_(config), state_(count, 0), dwell_(count, 0) {}
+
+    /**
+     * Add a component in BALANCED state
+     *
+     * @return Its index
+     */
+    size_t add() {
+        state_.push_back(0);
+        dwell_.push_back(0);
+        return state_.size() - 1;
+    }
+
+    void resize(size_t count) {
+        state_.resize(count, 0);
+        dwell_.resize(count, 0);
+    }
+
+    void reset(size_t index) {
+        state_[index] = 0;
+        dwell_[index] = 0;
+    }
+
+    size_t size() const { return state_.size(); }
+
+    BalanceState state(size_t index) const { return static_cast<BalanceState>(state_[index]); }
+    std::uint16_t dwell(size_t index) const { return dwell_[index]; }
+
+    const HysteresisConfig& config() const { return config_; }
+    void setConfig(const HysteresisConfig& config) { config_ = config; }
+
+    /**
+     * One tick for one component
+     */
+    double step(size_t index, double imbalance, double current_throttle) {
+        return hysteresisStep(config_, state_[index], dwell_[index], imbalance, current_throttle);
+    }
+
+    /**
+     * One tick for components [0, count): imbalance[i] / current_throttle[i]
+     * belong to component i
+     *
+     * @param out_action   MitigationAction ordinal per component (may be null)
+     * @param out_throttle New throttle level per component
+     */
+    void stepBatch(const double* imbalance, const double* current_throttle, size_t count,
+                   std::uint8_t* out_action, double* out_throttle) {
+        const HysteresisConfig c = config_;
+        std::uint8_t* state = state_.data();
+        std::uint16_t* dwell = dwell_.data();
+
+        for (size_t i = 0; i < count; ++i) {
+            out_throttle[i] = hysteresisStep(c, state[i], dwell[i], imbalance[i], current_throttle[i]);
+        }
+
+        if (out_action) {
+            // BalanceState -> MitigationAction: 0 -> NONE, 1 -> THROTTLE, 2 -> ALERT
+            constexpr auto ALERT = static_cast<std::uint8_t>(MitigationAction::ALERT);
+            for (size_t i = 0; i < count; ++i) {
+                out_action[i] = state[i] == 2 ? ALERT : state[i];
+            }
+        }
+    }
+};
+
+} // namespace neural
+} // namespace synapse
+
+#endif // SYNAPSE_BALANCING_HYSTERESIS_HPP
@@ -0,0 +1,158 @@
+/**
+ * SYNAPSE Neural Connection Layer - Shared Types
+ * ==============================================
+ *
+ * Thresholds and enums shared by the full balancer and the embedded
+ * (fixed-point, no-heap) builds. Depends on <cstdint> only, so it can
+ * be included on targets without an RTOS or a hosted standard library.
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#ifndef SYNAPSE_BALANCING_TYPES_HPP
+#define SYNAPSE_BALANCING_TYPES_HPP
+
+#include <cstdint>
+
+namespace synapse {
+namespace neural {
+
+// =============================================================================
+// CONSTANTS & THRESHOLDS
+// =============================================================================
+
+struct Thresholds {
+    // IDI Thresholds
+    static constexpr double IDI_HEALTHY = 3.0;
+    static constexpr double IDI_WARNING = 5.0;
+    static constexpr double IDI_CRITICAL = 7.0;
+    static constexpr double IDI_QUARANTINE = 10.0;
+
+    // Hardware Constraints
+    static constexpr double CPU_WARNING = 70.0;
+    static constexpr double CPU_CRITICAL = 85.0;
+    static constexpr double CPU_EMERGENCY = 95.0;
+
+    static constexpr double MEMORY_WARNING = 75.0;
+    static constexpr double MEMORY_CRITICAL = 90.0;
+
+    static constexpr double TEMPERATURE_WARNING = 70.0;
+    static constexpr double TEMPERATURE_CRITICAL = 85.0;
+    static constexpr double TEMPERATURE_SHUTDOWN = 95.0;
+
+    // Balancing
+    static constexpr double HW_SW_IMBALANCE_THRESHOLD = 0.3;
+    static constexpr double LATENCY_WARNING_MS = 100.0;
+    static constexpr double LATENCY_CRITICAL_MS = 500.0;
+};
+
+/**
+ * Runtime-tunable copy of Thresholds
+ *
+ * Defaults mirror the compile-time constants. Instances are immutable once
+ * published through a ThresholdStore.
+ */
+struct RuntimeThresholds {
+    std::uint64_t version = 0;
+
+    double idi_healthy = Thresholds::IDI_HEALTHY;
+    double idi_warning = Thresholds::IDI_WARNING;
+    double idi_critical = Thresholds::IDI_CRITICAL;
+    double idi_quarantine = Thresholds::IDI_QUARANTINE;
+
+    double cpu_warning = Thresholds::CPU_WARNING;
+    double cpu_critical = Thresholds::CPU_CRITICAL;
+    double cpu_emergency = Thresholds::CPU_EMERGENCY;
+
+    double memory_warning = Thresholds::MEMORY_WARNING;
+    double memory_critical = Thresholds::MEMORY_CRITICAL;
+
+    double temperature_warning = Thresholds::TEMPERATURE_WARNING;
+    double temperature_critical = Thresholds::TEMPERATURE_CRITICAL;
+    double temperature_shutdown = Thresholds::TEMPERATURE_SHUTDOWN;
+
+    double hw_sw_imbalance_threshold = Thresholds::HW_SW_IMBALANCE_THRESHOLD;
+    double latency_warning_ms = Thresholds::LATENCY_WARNING_MS;
+    double latency_critical_ms = Thresholds::LATENCY_CRITICAL_MS;
+};
+
+inline constexpr RuntimeThresholds DEFAULT_THRESHOLDS{};
+
+// =============================================================================
+// ENUMS
+// =============================================================================
+
+enum class SeverityLevel {
+    HEALTHY,
+    WARNING,
+    CRITICAL,
+    QUARANTINE
+};
+
+enum class MitigationAction {
+    NONE,
+    THROTTLE,
+    BRAKE,
+    QUARANTINE,
+    REBALANCE,
+    ALERT,
+    AUTO_INTEGRATE
+};
+
+enum class ComponentType {
+    HARDWARE,
+    SOFTWARE,
+    FIRMWARE,
+    HYBRID
+};
+
+enum class FlavorType {
+    IOT,
+    CLOUD,
+    EMBEDDED,
+    INFRA,
+    DATA,
+    MOBILE
+};
+
+// Lower-case names, matching the Python enum values
+inline const char* toString(SeverityLevel level) {
+    switch (level) {
+        case SeverityLevel::HEALTHY: return "healthy";
+        case SeverityLevel::WARNING: return "warning";
+        case SeverityLevel::CRITICAL: return "critical";
+        case SeverityLevel::QUARANTINE: return "quarantine";
+    }
+    return "unknown";
+}
+
+inline const char* toString(MitigationAction action) {
+    switch (action) {
+        case MitigationAction::NONE: return "none";
+        case MitigationAction::THROTTLE: return "throttle";
+        case MitigationAction::BRAKE: return "brake";
+        case MitigationAction::QUARANTINE: return "quarantine";
+        case MitigationAction::REBALANCE: return "rebalance";
+        case MitigationAction::ALERT: return "alert";
+        case MitigationAction::AUTO_INTEGRATE: return "auto_integrate";
+    }
+    return "unknown";
+}
+
+inline const char* toString(FlavorType flavor) {
+    switch (flavor) {
+        case FlavorType::IOT: return "iot";
+        case FlavorType::CLOUD: return "cloud";
+        case FlavorType::EMBEDDED: return "embedded";
+        case FlavorType::INFRA: return "infra";
+        case FlavorType::DATA: return "data";
+        case FlavorType::MOBILE: return "mobile";
+    }
+    return "unknown";
+}
+
+} // namespace neural
+} // namespace synapse
+
+#endif // SYNAPSE_BALANCING_TYPES_HPP
@@ -0,0 +1,52 @@
+#!/bin/sh
+#
+# SYNAPSE - Embedded profile flash/RAM check
+#
+# Builds bench/embedded_footprint.cpp for Cortex-M0 in every strip
+# configuration, links it against libgcc (so the 64-bit divide helpers
+# are counted) and fails if code + initialized data exceeds the flash
+# budget documented in embedded_balancer.hpp.
+#
+# Usage: bench/check_footprint.sh [flash-budget-bytes]
+#   CXX   cross compiler  (default arm-none-eabi-g++)
+#   SIZE  size utility    (default arm-none-eabi-size)
+#
+# Author: SYNAPSE Framework Team
+# License: MIT
+
+set -eu
+
+BUDGET=${1:-4096}
+CXX=${CXX:-arm-none-eabi-g++}
+SIZE=${SIZE:-arm-none-eabi-size}
+
+HERE=$(cd "$(dirname "$0")" && pwd)
+OUT=$(mktemp -d)
+trap 'rm -rf "$OUT"' EXIT
+
+CXXFLAGS="-std=c++17 -Os -mcpu=cortex-m0 -mthumb -ffreestanding -fno-exceptions -fno-rtti \
+    -ffunction-sections -fdata-sections -DSYNAPSE_EMBEDDED_PROFILE -I$HERE/.."
+# No startup code: keep the C entry points alive and let gc-sections drop the rest
+LDFLAGS="-nostartfiles -nostdlib -Wl,--gc-sections -Wl,--entry=synapse_embedded_tick \
+    -Wl,--undefined=synapse_embedded_init -Wl,--undefined=synapse_embedded_add \
+    -Wl,--undefined=synapse_embedded_pid -Wl,--undefined=synapse_embedded_idi -lgcc"
+
+status=0
+for config in "" "-DSYNAPSE_EMBEDDED_NO_PID" "-DSYNAPSE_EMBEDDED_NO_PRUNING" \
+              "-DSYNAPSE_EMBEDDED_NO_PID -DSYNAPSE_EMBEDDED_NO_PRUNING"; do
+    # shellcheck disable=SC2086
+    $CXX $CXXFLAGS $config "$HERE/embedded_footprint.cpp" $LDFLAGS -o "$OUT/footprint.elf"
+
+    # Berkeley format: text data bss dec hex filename
+    set -- $($SIZE -B "$OUT/footprint.elf" | tail -n 1)
+    flash=$(($1 + $2))
+    ram=$(($2 + $3))
+
+    printf '%-60s flash %5d  ram %5d\n' "${config:-default}" "$flash" "$ram"
+    if [ "$flash" -gt "$BUDGET" ]; then
+        echo "  exceeds flash budget of $BUDGET bytes" >&2
+        status=1
+    fi
+done
+
+exit $status
@@ -0,0 +1,89 @@
+/**
+ * SYNAPSE - Bench cycle counter
+ * =============================
+ *
+ * Cycle source: DWT->CYCCNT (ARMv7-M/v8-M Mainline), SysTick
+ * (ARMv6-M/v8-M Baseline, e.g. Cortex-M0/M0+), RDTSC (x86), otherwise
+ * nanoseconds from steady_clock. Shared by the bench/ programs.
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#ifndef SYNAPSE_BENCH_CYCLE_COUNTER_HPP
+#define SYNAPSE_BENCH_CYCLE_COUNTER_HPP
+
+#include <cstdint>
+
+#if !defined(__arm__) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#elif !defined(__arm__)
+#include <chrono>
+#endif
+
+namespace synapse {
+namespace bench {
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+
+inline constexpr const char* COUNTER_UNIT = "cycles (DWT)";
+
+inline volatile std::uint32_t& reg(std::uintptr_t address) {
+    return *reinterpret_cast<volatile std::uint32_t*>(address);
+}
+
+inline void counterInit() {
+    reg(0xE000EDFC) |= 1u << 24;  // DEMCR.TRCENA
+    reg(0xE0001004) = 0;          // DWT_CYCCNT
+    reg(0xE0001000) |= 1u;        // DWT_CTRL.CYCCNTENA
+}
+
+inline std::uint32_t counterRead() { return reg(0xE0001004); }
+inline std::uint32_t counterElapsed(std::uint32_t start, std::uint32_t end) { return end - start; }
+
+#elif defined(__ARM_ARCH_6M__) || defined(__ARM_ARCH_8M_BASE__)
+
+inline constexpr const char* COUNTER_UNIT = "cycles (SysTick)";
+
+inline volatile std::uint32_t& reg(std::uintptr_t address) {
+    return *reinterpret_cast<volatile std::uint32_t*>(address);
+}
+
+inline void counterInit() {
+    reg(0xE000E014) = 0x00FFFFFF;  // SYST_RVR: full 24-bit range
+    reg(0xE000E018) = 0;           // SYST_CVR
+    reg(0xE000E010) = 0x5;         // SYST_CSR: processor clock, enabled, no IRQ
+}
+
+inline std::uint32_t counterRead() { return reg(0xE000E018); }
+
+// Down-counter; spans must stay under 2^24 cycles (one batch easily does)
+inline std::uint32_t counterElapsed(std::uint32_t start, std::uint32_t end) {
+    return (start - end) & 0x00FFFFFF;
+}
+
+#elif defined(__x86_64__) || defined(__i386__)
+
+inline constexpr const char* COUNTER_UNIT = "TSC ticks";
+
+inline void counterInit() {}
+inline std::uint32_t counterRead() { return static_cast<std::uint32_t>(__rdtsc()); }
+inline std::uint32_t counterElapsed(std::uint32_t start, std::uint32_t end) { return end - start; }
+
+#else
+
+inline constexpr const char* COUNTER_UNIT = "ns";
+
+inline void counterInit() {}
+inline std::uint32_t counterRead() {
+    return static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+inline std::uint32_t counterElapsed(std::uint32_t start, std::uint32_t end) { return end - start; }
+
+#endif
+
+} // namespace bench
+} // namespace synapse
+
+#endif // SYNAPSE_BENCH_CYCLE_COUNTER_HPP
@@ -0,0 +1,89 @@
+/**
+ * SYNAPSE - Embedded profile footprint probe
+ * ==========================================
+ *
+ * One EmbeddedEngine<Q16_16> with the default configuration behind a
+ * minimal C entry surface, so the linker keeps exactly what a firmware
+ * would use. The RAM budget is checked here at compile time; the flash
+ * budget by bench/check_footprint.sh on the linked object.
+ *
+ * Build (object only, no startup code needed):
+ *   arm-none-eabi-g++ -std=c++17 -Os -mcpu=cortex-m0 -mthumb \
+ *       -ffreestanding -fno-exceptions -fno-rtti \
+ *       -ffunction-sections -fdata-sections \
+ *       -DSYNAPSE_EMBEDDED_PROFILE -I.. -c embedded_footprint.cpp
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#include "embedded_balancer.hpp"
+
+#include <cstdint>
+#include <new>
+
+using namespace synapse::neural;
+
+namespace {
+
+using Engine = embedded::EmbeddedEngine<fixed::Q16_16>;
+using Q = fixed::Q16_16;
+
+constexpr std::size_t RAM_BUDGET = 1536;
+
+static_assert(sizeof(Engine) <= RAM_BUDGET,
+              "default EmbeddedEngine exceeds the 1.5 KiB RAM budget");
+static_assert(sizeof(fixed::BasicTelemetry<Q>) <= 32,
+              "telemetry sample should stay register/stack friendly");
+
+// Constructed by synapse_embedded_init() so the table lives in .bss: a
+// constant-initialized global would also cost its image in flash (.data)
+alignas(Engine) unsigned char engine_storage[sizeof(Engine)];
+Engine* engine = nullptr;
+
+} // namespace
+
+extern "C" {
+
+void synapse_embedded_init(std::uint32_t min_quarantine_ticks) {
+    engine = new (engine_storage) Engine(min_quarantine_ticks);
+}
+
+std::uint16_t synapse_embedded_add(void) {
+    return engine->add();
+}
+
+/**
+ * Raw Q16.16 inputs; returns the action, writes the Q16.16 throttle
+ */
+std::uint8_t synapse_embedded_tick(std::uint16_t id, const std::int32_t* telemetry,
+                                   std::int32_t idi, std::int32_t health_score,
+                                   std::uint32_t now, std::int32_t* throttle) {
+    embedded::ComponentInput<Q> in{};
+    in.telemetry.cpu_usage = Q::fromRaw(telemetry[0]);
+    in.telemetry.memory_usage = Q::fromRaw(telemetry[1]);
+    in.telemetry.io_latency_ms = Q::fromRaw(telemetry[2]);
+    in.telemetry.network_latency_ms = Q::fromRaw(telemetry[3]);
+    in.telemetry.error_rate = Q::fromRaw(telemetry[4]);
+    in.telemetry.throughput = Q::fromRaw(telemetry[5]);
+    in.telemetry.temperature = Q::fromRaw(telemetry[6]);
+    in.telemetry.has_temperature = telemetry[7] != 0;
+    in.idi = Q::fromRaw(idi);
+    in.health_score = Q::fromRaw(health_score);
+
+    embedded::EngineResult<Q> result = engine->tick(id, in, now);
+    *throttle = result.throttle_level.raw();
+    return static_cast<std::uint8_t>(result.action);
+}
+
+#if !defined(SYNAPSE_EMBEDDED_NO_PID)
+std::int32_t synapse_embedded_pid(std::uint16_t id, std::int32_t utilization) {
+    return engine->pidAdjust(id, Q::fromRaw(utilization)).raw();
+}
+#endif
+
+std::int32_t synapse_embedded_idi(int days, int loc_changed, int dependencies) {
+    return fixed::BasicIDICalculator<Q>::calculate(days, loc_changed, dependencies).raw();
+}
+
+} // extern "C"
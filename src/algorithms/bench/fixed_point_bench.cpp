@@ -0,0 +1,300 @@
+/**
+ * SYNAPSE - Fixed-point vs. soft-float cycle benchmark
+ * ====================================================
+ *
+ * Times BasicBalancerScoring / BasicIDIBrake / BasicPIDController /
+ * BasicIDICalculator instantiated on double and on Q16_16 over the same
+ * inputs. Then sweeps SWEEP random samples (default 2M, the sweep behind
+ * the error table in fixed_point.hpp) and reports the largest Q16_16
+ * deviation seen (in units of ε = 2^-17) and how many decide() calls
+ * chose a different action. On an FPU-less core the double
+ * instantiation is the soft-float build; pass -DSWEEP=... to shorten
+ * the sweep there.
+ *
+ * Cycle source: DWT->CYCCNT (ARMv7-M/v8-M Mainline), SysTick
+ * (ARMv6-M/v8-M Baseline, e.g. Cortex-M0/M0+), RDTSC (x86), otherwise
+ * nanoseconds from steady_clock.
+ *
+ * Build:
+ *   Host:
+ *     g++ -std=c++17 -O2 -I.. fixed_point_bench.cpp -o fixed_point_bench
+ *   Cortex-M0 (semihosting output; run on hardware for real cycle counts):
+ *     arm-none-eabi-g++ -std=c++17 -O2 -mcpu=cortex-m0 -mthumb \
+ *         -fno-exceptions -fno-rtti -I.. fixed_point_bench.cpp \
+ *         --specs=nano.specs --specs=rdimon.specs -lrdimon -o fixed_point_bench.elf
+ *
+ * Only integers are printed, so newlib-nano needs no float printf.
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#include "fixed_point.hpp"
+#include "cycle_counter.hpp"
+
+#include <cstdint>
+#include <cstdio>
+
+using namespace synapse::neural;
+using namespace synapse::neural::fixed;
+using namespace synapse::bench;
+
+namespace {
+
+// =============================================================================
+// INPUTS
+// =============================================================================
+
+constexpr std::size_t BATCH = 64;
+constexpr int ROUNDS = 32;
+
+#ifndef SWEEP
+#define SWEEP 2000000
+#endif
+constexpr std::uint32_t SWEEP_BATCHES = (SWEEP + BATCH - 1) / BATCH;
+
+struct Rng {
+    std::uint32_t state = 0x9E3779B9u;
+
+    std::uint32_t next() {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    // [0, scale) with 1/65536 steps; generated as integers to keep setup cheap
+    double uniform(double scale) { return (next() & 0xFFFF) * (scale / 65536.0); }
+};
+
+template <typename T>
+struct Inputs {
+    BasicTelemetry<T> telemetry[BATCH];
+    T idi[BATCH];
+    T utilization[BATCH];
+    T throttle[BATCH];
+};
+
+struct IntInputs {
+    int days[BATCH];
+    int loc[BATCH];
+    int deps[BATCH];
+};
+
+template <typename T>
+T to(double value) { return num<T>(value); }
+
+template <typename T>
+void fill(Inputs<T>& in, const double (&raw)[BATCH][10]) {
+    for (std::size_t i = 0; i < BATCH; ++i) {
+        const double* r = raw[i];
+        in.telemetry[i] = {to<T>(r[0]), to<T>(r[1]), to<T>(r[2]), to<T>(r[3]), to<T>(r[4]),
+                           to<T>(r[5]), to<T>(r[6]), (i & 1) != 0};
+        in.idi[i] = to<T>(r[7]);
+        in.utilization[i] = to<T>(r[8]);
+        in.throttle[i] = to<T>(r[9]);
+    }
+}
+
+// Keeps results alive without a float store per call
+volatile std::int32_t g_sink;
+
+template <typename T>
+std::int32_t bits(T value) {
+    if constexpr (sizeof(T) == sizeof(std::int32_t)) {
+        return value.raw();
+    } else {
+        return static_cast<std::int32_t>(value > num<T>(0.5));
+    }
+}
+
+// =============================================================================
+// KERNELS
+// =============================================================================
+
+struct Timing {
+    std::uint32_t scoring = 0;
+    std::uint32_t brake = 0;
+    std::uint32_t pid = 0;
+    std::uint32_t idi = 0;
+};
+
+template <typename T>
+Timing run(const Inputs<T>& in, const IntInputs& ints) {
+    BasicBalancerScoring<T> scoring;
+    BasicPIDController<T> pid;
+    Timing best{UINT32_MAX, UINT32_MAX, UINT32_MAX, UINT32_MAX};
+
+    for (int round = 0; round < ROUNDS; ++round) {
+        std::int32_t acc = 0;
+
+        std::uint32_t start = counterRead();
+        for (std::size_t i = 0; i < BATCH; ++i) {
+            T hw = scoring.hardwareCapacity(in.telemetry[i]);
+            T sw = scoring.softwareDemand(in.telemetry[i]);
+            BasicDecision<T> d = scoring.decide(scoring.imbalance(hw, sw), in.throttle[i]);
+            acc += static_cast<std::int32_t>(d.action) + bits(d.throttle_level);
+        }
+        std::uint32_t elapsed = counterElapsed(start, counterRead());
+        if (elapsed < best.scoring) best.scoring = elapsed;
+
+        start = counterRead();
+        for (std::size_t i = 0; i < BATCH; ++i) {
+            acc += bits(BasicIDIBrake<T>::throttleLevel(in.idi[i]));
+        }
+        elapsed = counterElapsed(start, counterRead());
+        if (elapsed < best.brake) best.brake = elapsed;
+
+        start = counterRead();
+        for (std::size_t i = 0; i < BATCH; ++i) {
+            acc += bits(pid.calculate(in.utilization[i]));
+        }
+        elapsed = counterElapsed(start, counterRead());
+        if (elapsed < best.pid) best.pid = elapsed;
+
+        start = counterRead();
+        for (std::size_t i = 0; i < BATCH; ++i) {
+            acc += bits(BasicIDICalculator<T>::calculate(ints.days[i], ints.loc[i], ints.deps[i]));
+        }
+        elapsed = counterElapsed(start, counterRead());
+        if (elapsed < best.idi) best.idi = elapsed;
+
+        g_sink = acc;
+    }
+    return best;
+}
+
+// =============================================================================
+// ACCURACY
+// =============================================================================
+
+constexpr double EPSILON = 1.0 / 131072.0;  // 2^-17
+
+struct Deviation {
+    double capacity = 0, demand = 0, imbalance = 0, brake = 0, pid = 0, idi = 0;
+
+    static void track(double& worst, double expected, Q16_16 actual) {
+        double diff = actual.toDouble() - expected;
+        if (diff < 0) diff = -diff;
+        if (diff > worst) worst = diff;
+    }
+};
+
+/**
+ * Double vs. Q16_16 over consecutive batches; the PID controllers keep
+ * their state across batches like a controller across ticks
+ */
+struct Comparison {
+    BasicBalancerScoring<double> sd;
+    BasicBalancerScoring<Q16_16> sq;
+    BasicPIDController<double> pd;
+    BasicPIDController<Q16_16> pq;
+    Deviation dev;
+    std::uint32_t samples = 0;
+    std::uint32_t decide_flips = 0;
+
+    void add(const Inputs<double>& d, const Inputs<Q16_16>& q, const IntInputs& ints) {
+        for (std::size_t i = 0; i < BATCH; ++i) {
+            double hw = sd.hardwareCapacity(d.telemetry[i]);
+            double sw = sd.softwareDemand(d.telemetry[i]);
+            Q16_16 hq = sq.hardwareCapacity(q.telemetry[i]);
+            Q16_16 wq = sq.softwareDemand(q.telemetry[i]);
+            Deviation::track(dev.capacity, hw, hq);
+            Deviation::track(dev.demand, sw, wq);
+
+            double imbalance = sd.imbalance(hw, sw);
+            Q16_16 imbalance_q = sq.imbalance(hq, wq);
+            Deviation::track(dev.imbalance, imbalance, imbalance_q);
+            if (sd.decide(imbalance, d.throttle[i]).action != sq.decide(imbalance_q, q.throttle[i]).action) {
+                ++decide_flips;
+            }
+
+            Deviation::track(dev.brake, BasicIDIBrake<double>::throttleLevel(d.idi[i]),
+                             BasicIDIBrake<Q16_16>::throttleLevel(q.idi[i]));
+            Deviation::track(dev.pid, pd.calculate(d.utilization[i]), pq.calculate(q.utilization[i]));
+
+            double idi = BasicIDICalculator<double>::calculate(ints.days[i], ints.loc[i], ints.deps[i]);
+            Deviation::track(dev.idi, idi, BasicIDICalculator<Q16_16>::calculate(ints.days[i], ints.loc[i], ints.deps[i]));
+        }
+        samples += BATCH;
+    }
+};
+
+void generate(Rng& rng, double (&raw)[BATCH][10], IntInputs& ints) {
+    for (std::size_t i = 0; i < BATCH; ++i) {
+        raw[i][0] = rng.uniform(100.0);     // cpu
+        raw[i][1] = rng.uniform(100.0);     // memory
+        raw[i][2] = rng.uniform(700.0);     // io latency
+        raw[i][3] = rng.uniform(50.0);      // network latency
+        raw[i][4] = rng.uniform(0.2);       // error rate
+        raw[i][5] = rng.uniform(3000.0);    // throughput
+        raw[i][6] = 20.0 + rng.uniform(80.0);  // temperature
+        raw[i][7] = rng.uniform(14.0);      // IDI
+        raw[i][8] = rng.uniform(100.0);     // PID input
+        raw[i][9] = rng.uniform(1.0);       // current throttle
+        ints.days[i] = static_cast<int>(rng.next() % 120);
+        ints.loc[i] = static_cast<int>(rng.next() % 20000);
+        ints.deps[i] = static_cast<int>(rng.next() % 40);
+    }
+}
+
+void timingRow(const char* name, std::uint32_t soft, std::uint32_t fixed) {
+    unsigned speedup = fixed ? static_cast<unsigned>((static_cast<std::uint64_t>(soft) * 10) / fixed) : 0;
+    std::printf("  %-16s %10lu %10lu %6u.%ux\n", name,
+                static_cast<unsigned long>(soft / BATCH), static_cast<unsigned long>(fixed / BATCH),
+                speedup / 10, speedup % 10);
+}
+
+void errorRow(const char* name, double error) {
+    unsigned tenths = static_cast<unsigned>(error / EPSILON * 10.0 + 0.5);
+    std::printf("  %-16s %6u.%u\n", name, tenths / 10, tenths % 10);
+}
+
+} // namespace
+
+int main() {
+    counterInit();
+
+    static double raw[BATCH][10];
+    static IntInputs ints;
+    Rng rng;
+    generate(rng, raw, ints);
+
+    static Inputs<double> soft;
+    static Inputs<Q16_16> fixed;
+    fill(soft, raw);
+    fill(fixed, raw);
+
+    Timing ts = run(soft, ints);
+    Timing tf = run(fixed, ints);
+
+    static Comparison sweep;
+    sweep.add(soft, fixed, ints);
+    for (std::uint32_t batch = 1; batch < SWEEP_BATCHES; ++batch) {
+        generate(rng, raw, ints);
+        fill(soft, raw);
+        fill(fixed, raw);
+        sweep.add(soft, fixed, ints);
+    }
+    const Deviation& dev = sweep.dev;
+
+    std::printf("per call, %s (best of %d rounds x %u calls)\n", COUNTER_UNIT, ROUNDS,
+                static_cast<unsigned>(BATCH));
+    std::printf("  %-16s %10s %10s %8s\n", "kernel", "double", "Q16_16", "speedup");
+    timingRow("scoring+decide", ts.scoring, tf.scoring);
+    timingRow("idi brake", ts.brake, tf.brake);
+    timingRow("pid", ts.pid, tf.pid);
+    timingRow("idi calculate", ts.idi, tf.idi);
+
+    std::printf("max |Q16_16 - double| in units of 2^-17 over %lu samples\n",
+                static_cast<unsigned long>(sweep.samples));
+    errorRow("capacity", dev.capacity);
+    errorRow("demand", dev.demand);
+    errorRow("imbalance", dev.imbalance);
+    errorRow("brake", dev.brake);
+    errorRow("pid", dev.pid);
+    errorRow("idi", dev.idi);
+    std::printf("decide() action mismatches: %lu of %lu\n",
+                static_cast<unsigned long>(sweep.decide_flips), static_cast<unsigned long>(sweep.samples));
+    return 0;
+}
@@ -0,0 +1,154 @@
+/**
+ * SYNAPSE - ISR telemetry ring WCET probe
+ * =======================================
+ *
+ * Times every IsrTelemetryRing::push() (free and full ring) and every
+ * drainAndBalance() sample individually and reports the worst case, the
+ * 99.9th percentile and the median, in the units of
+ * bench/cycle_counter.hpp. On hardware, run it with interrupts disabled
+ * around the timed regions for clean figures; on a host the maximum
+ * includes interrupts and preemption, so read the p99.9 column there.
+ *
+ * Build:
+ *   Host:
+ *     g++ -std=c++17 -O2 -I.. isr_ring_wcet.cpp -o isr_ring_wcet
+ *   Cortex-M0 (semihosting output):
+ *     arm-none-eabi-g++ -std=c++17 -O2 -mcpu=cortex-m0 -mthumb \
+ *         -fno-exceptions -fno-rtti -DSYNAPSE_EMBEDDED_PROFILE -I.. \
+ *         isr_ring_wcet.cpp --specs=nano.specs --specs=rdimon.specs \
+ *         -lrdimon -o isr_ring_wcet.elf
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#include "isr_telemetry_ring.hpp"
+#include "cycle_counter.hpp"
+#include "wcet_histogram.hpp"
+
+#include <cstdint>
+#include <cstdio>
+
+using namespace synapse::neural;
+using namespace synapse::neural::embedded;
+using namespace synapse::bench;
+
+namespace {
+
+using Q = fixed::Q16_16;
+
+#if defined(__arm__)
+constexpr std::uint32_t ITERATIONS = 20000;
+#else
+constexpr std::uint32_t ITERATIONS = 1000000;
+#endif
+
+struct Rng {
+    std::uint32_t state = 0x9E3779B9u;
+
+    std::uint32_t next() {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    Q uniform(std::int32_t scale) {
+        return Q::fromRaw(static_cast<std::int32_t>(next() & 0xFFFF) * scale);
+    }
+};
+
+BasicTelemetry<Q> sample(Rng& rng) {
+    BasicTelemetry<Q> t;
+    t.cpu_usage = rng.uniform(100);
+    t.memory_usage = rng.uniform(100);
+    t.io_latency_ms = rng.uniform(300);
+    t.network_latency_ms = rng.uniform(50);
+    t.error_rate = Q::fromRaw(static_cast<std::int32_t>(rng.next() & 0x1FFF));
+    t.throughput = rng.uniform(1500);
+    t.has_temperature = (rng.next() & 1) != 0;
+    t.temperature = rng.uniform(100);
+    return t;
+}
+
+IsrTelemetryRing<Q> ring;
+EmbeddedEngine<Q> engine;
+Histogram<> push_free, push_full, tick_one;
+std::uint32_t overhead = 0;   // Back-to-back counterRead() cost, subtracted
+
+std::uint32_t elapsed(std::uint32_t start, std::uint32_t end) {
+    std::uint32_t span = counterElapsed(start, end);
+    return span > overhead ? span - overhead : 0;
+}
+
+void calibrate() {
+    Histogram<> empty;
+    for (int i = 0; i < 10000; ++i) {
+        std::uint32_t start = counterRead();
+        empty.add(counterElapsed(start, counterRead()));
+    }
+    overhead = empty.percentile(500);
+}
+
+void print(const char* name, const Histogram<>& h) {
+    std::printf("  %-22s %8lu %8lu %8lu\n", name, static_cast<unsigned long>(h.max),
+                static_cast<unsigned long>(h.percentile(999)),
+                static_cast<unsigned long>(h.percentile(500)));
+}
+
+} // namespace
+
+int main() {
+    counterInit();
+    calibrate();
+    Rng rng;
+
+    for (std::size_t i = 0; i < engine.capacity(); ++i) {
+        ComponentId id = engine.add();
+        engine.setIntegrationState(id, rng.uniform(12), rng.uniform(100));
+    }
+
+    volatile std::uint32_t sink = 0;
+    std::uint32_t now = 0;
+
+    for (std::uint32_t i = 0; i < ITERATIONS; ++i) {
+        BasicTelemetry<Q> t = sample(rng);
+        auto id = static_cast<ComponentId>(rng.next() % engine.size());
+
+        std::uint32_t start = counterRead();
+        bool accepted = ring.push(id, t);
+        std::uint32_t end = counterRead();
+        (accepted ? push_free : push_full).add(elapsed(start, end));
+
+        // Drain in bursts so pushes see every fill level, including full
+        if ((rng.next() & 31) == 0) {
+            drainAndBalance(ring, engine, ++now, [&](const TelemetrySample<Q>&, const EngineResult<Q>& r) {
+                sink = sink + static_cast<std::uint32_t>(r.throttle_level.raw());
+            });
+        }
+    }
+
+    // Per-sample balancer cost, timed one tick at a time
+    for (std::uint32_t i = 0; i < ITERATIONS; ++i) {
+        BasicTelemetry<Q> t = sample(rng);
+        auto id = static_cast<ComponentId>(rng.next() % engine.size());
+        ring.push(id, t);
+
+        std::uint32_t start = counterRead();
+        drainAndBalance(ring, engine, ++now, [&](const TelemetrySample<Q>&, const EngineResult<Q>& r) {
+            sink = sink + static_cast<std::uint32_t>(r.action);
+        });
+        tick_one.add(elapsed(start, counterRead()));
+    }
+
+    std::printf("IsrTelemetryRing<Q16_16, %lu>, %s (counter overhead %lu subtracted)\n",
+                static_cast<unsigned long>(ring.capacity()), COUNTER_UNIT,
+                static_cast<unsigned long>(overhead));
+    std::printf("  %-22s %8s %8s %8s\n", "operation", "max", "p99.9", "median");
+    print("push (accepted)", push_free);
+    print("push (full, dropped)", push_full);
+    print("drainAndBalance / 1", tick_one);
+    std::printf("  dropped: %lu of %lu\n", static_cast<unsigned long>(ring.dropped()),
+                static_cast<unsigned long>(ITERATIONS));
+    return 0;
+}
@@ -0,0 +1,338 @@
+/**
+ * SYNAPSE - Real-time controller WCET harness
+ * ===========================================
+ *
+ * Times every RealtimeController::step() under cache-thrashing
+ * interference and fails when the worst case exceeds a bound:
+ *
+ *   cold  Before each timed step the loop sweeps a buffer twice the size
+ *         of the last-level cache, so code and state come from memory.
+ *   warm  Steps back to back over all components, as the 1 kHz loop runs
+ *         them, while thrasher threads on the other CPUs stream writes
+ *         over their own LLC-sized buffers.
+ *
+ * Global operator new is replaced to count allocations made by the
+ * timing thread inside the timed regions; any allocation fails the run.
+ *
+ * Usage:
+ *   realtime_wcet [--bound=TICKS] [--check=max|PER_MILLE] [--cold=N]
+ *                 [--warm=N] [--threads=N]      [--fifo=PRIORITY]
+ *
+ *   --bound    limit in counter units (bench/cycle_counter.hpp) [20000]
+ *   --check    statistic compared with the bound: the maximum, or a
+ *              percentile in per mille (999 = p99.9)        [max]
+ *   --cold     cold samples (each sweeps 2x LLC first)      [500]
+ *   --warm     passes over all components                   [200]
+ *   --threads  thrasher threads; with 0 (the default on one CPU) the
+ *              warm row runs without interference            [CPUs - 1]
+ *   --fifo     run the timing thread SCHED_FIFO at PRIORITY (needs
+ *              privileges; without it the maximum includes preemption)
+ *
+ * Exit status: 0 within the bound, 1 bound exceeded, 2 allocation on the
+ * decision path, 3 usage error.
+ *
+ * Build:
+ *   g++ -std=c++17 -O2 -I.. realtime_wcet.cpp -o realtime_wcet -lpthread
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#include "realtime_controller.hpp"
+#include "cycle_counter.hpp"
+#include "wcet_histogram.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+using namespace synapse::neural;
+using namespace synapse::neural::realtime;
+using namespace synapse::bench;
+
+// =============================================================================
+// ALLOCATION COUNTER
+// =============================================================================
+
+namespace {
+
+thread_local bool counting_allocations = false;
+std::atomic<std::uint64_t> decision_path_allocations{0};
+
+void* allocate(std::size_t size) {
+    if (counting_allocations) decision_path_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+} // namespace
+
+void* operator new(std::size_t size) { return allocate(size); }
+void* operator new[](std::size_t size) { return allocate(size); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+// =============================================================================
+// SETUP
+// =============================================================================
+
+struct Options {
+    std::uint32_t bound = 20000;
+    std::uint32_t check = 0;   // 0 = maximum, otherwise per mille
+    std::uint32_t cold = 500;
+    std::uint32_t warm = 200;  // Passes over all components
+    unsigned threads = std::thread::hardware_concurrency() > 1
+                     ? std::thread::hardware_concurrency() - 1 : 0;
+    int fifo = 0;
+};
+
+bool parse(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        auto value = [&](const char* name) -> const char* {
+            std::size_t n = std::strlen(name);
+            return std::strncmp(arg, name, n) == 0 && arg[n] == '=' ? arg + n + 1 : nullptr;
+        };
+
+        if (const char* v = value("--bound")) {
+            options.bound = static_cast<std::uint32_t>(std::strtoul(v, nullptr, 10));
+        } else if (const char* v = value("--check")) {
+            options.check = std::strcmp(v, "max") == 0
+                          ? 0 : static_cast<std::uint32_t>(std::strtoul(v, nullptr, 10));
+        } else if (const char* v = value("--cold")) {
+            options.cold = static_cast<std::uint32_t>(std::strtoul(v, nullptr, 10));
+        } else if (const char* v = value("--warm")) {
+            options.warm = static_cast<std::uint32_t>(std::strtoul(v, nullptr, 10));
+        } else if (const char* v = value("--threads")) {
+            options.threads = static_cast<unsigned>(std::strtoul(v, nullptr, 10));
+        } else if (const char* v = value("--fifo")) {
+            options.fifo = std::atoi(v);
+        } else {
+            std::fprintf(stderr, "unknown option: %s\n", arg);
+            return false;
+        }
+    }
+    return options.check <= 1000;
+}
+
+std::size_t lastLevelCacheBytes() {
+#if defined(__linux__) && defined(_SC_LEVEL3_CACHE_SIZE)
+    long l3 = sysconf(_SC_LEVEL3_CACHE_SIZE);
+    if (l3 > 0) return static_cast<std::size_t>(l3);
+    long l2 = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    if (l2 > 0) return static_cast<std::size_t>(l2);
+#endif
+    return 32u * 1024 * 1024;
+}
+
+struct Rng {
+    std::uint64_t state = 0x9E3779B97F4A7C15ull;
+
+    std::uint64_t next() {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+
+    double uniform(double scale) { return static_cast<double>(next() >> 11) * 0x1.0p-53 * scale; }
+};
+
+struct Input {
+    ComponentId id;
+    double idi;
+    double health;
+    RealtimeTelemetry telemetry;
+};
+
+/**
+ * Inputs covering every branch: all severities, both temperature bands,
+ * latency bands, error rates that quarantine and recover
+ */
+std::vector<Input> makeInputs(std::size_t count, std::size_t components, Rng& rng) {
+    std::vector<Input> inputs(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        Input& in = inputs[i];
+        in.id = static_cast<ComponentId>(i % components);
+        in.idi = rng.uniform(12.0);
+        in.health = rng.uniform(100.0);
+        in.telemetry.cpu_usage = rng.uniform(100.0);
+        in.telemetry.memory_usage = rng.uniform(100.0);
+        in.telemetry.io_latency_ms = rng.uniform(300.0);
+        in.telemetry.network_latency_ms = rng.uniform(50.0);
+        in.telemetry.error_rate = rng.uniform(0.08);
+        in.telemetry.throughput = rng.uniform(1500.0);
+        in.telemetry.has_temperature = (rng.next() & 1) != 0;
+        in.telemetry.temperature = rng.uniform(100.0);
+    }
+    return inputs;
+}
+
+// =============================================================================
+// INTERFERENCE
+// =============================================================================
+
+std::atomic<bool> stop_thrashing{false};
+
+void thrash(std::size_t bytes) {
+    std::unique_ptr<unsigned char[]> buffer(new unsigned char[bytes]);
+    unsigned char value = 0;
+    while (!stop_thrashing.load(std::memory_order_relaxed)) {
+        for (std::size_t i = 0; i < bytes; i += 64) buffer[i] = value;
+        ++value;
+    }
+}
+
+/**
+ * Evict the working set of the timing thread: touch every line of a
+ * buffer larger than the LLC
+ */
+void evict(volatile unsigned char* buffer, std::size_t bytes) {
+    for (std::size_t i = 0; i < bytes; i += 64) buffer[i] = static_cast<unsigned char>(buffer[i] + 1);
+}
+
+// =============================================================================
+// MEASUREMENT
+// =============================================================================
+
+using Controller = RealtimeController<>;
+
+Controller controller(100);   // Short quarantine so restore paths run too
+Histogram<65536> cold, warm;
+std::uint32_t overhead = 0;
+
+std::uint32_t elapsed(std::uint32_t start, std::uint32_t end) {
+    std::uint32_t span = counterElapsed(start, end);
+    return span > overhead ? span - overhead : 0;
+}
+
+void calibrate() {
+    Histogram<> empty;
+    for (int i = 0; i < 10000; ++i) {
+        std::uint32_t start = counterRead();
+        empty.add(counterElapsed(start, counterRead()));
+    }
+    overhead = empty.percentile(500);
+}
+
+volatile double sink = 0.0;
+
+std::uint32_t timedStep(const Input& in) {
+    controller.setIntegrationState(in.id, in.idi, in.health);
+
+    counting_allocations = true;
+    std::uint32_t start = counterRead();
+    RealtimeResult r = controller.step(in.id, in.telemetry);
+    std::uint32_t end = counterRead();
+    counting_allocations = false;
+
+    sink = sink + r.throttle_level + r.pid_adjustment;
+    return elapsed(start, end);
+}
+
+std::uint32_t statistic(const Histogram<65536>& h, std::uint32_t check) {
+    return check == 0 ? h.max : h.percentile(check);
+}
+
+void print(const char* name, const Histogram<65536>& h) {
+    std::printf("  %-28s %9lu %9lu %9lu %9lu\n", name, static_cast<unsigned long>(h.max),
+                static_cast<unsigned long>(h.percentile(999)),
+                static_cast<unsigned long>(h.percentile(500)),
+                static_cast<unsigned long>(h.total));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parse(argc, argv, options)) {
+        std::fprintf(stderr, "usage: realtime_wcet [--bound=TICKS] [--check=max|PER_MILLE] "
+                             "[--cold=N] [--warm=N] [--threads=N] [--fifo=PRIORITY]\n");
+        return 3;
+    }
+
+    counterInit();
+    calibrate();
+
+    Rng rng;
+    for (std::size_t i = 0; i < controller.capacity(); ++i) controller.add();
+
+    const std::size_t components = controller.size();
+    std::vector<Input> cold_inputs = makeInputs(options.cold, components, rng);
+    std::vector<Input> warm_inputs = makeInputs(std::size_t(options.warm) * components, components, rng);
+
+    const std::size_t llc = lastLevelCacheBytes();
+    const std::size_t evict_bytes = 2 * llc;
+    std::unique_ptr<unsigned char[]> evict_buffer(new unsigned char[evict_bytes]());
+
+    RealtimeThreadStatus status = prepareRealtimeThread(options.fifo);
+
+    std::vector<std::thread> thrashers;
+    for (unsigned i = 0; i < options.threads; ++i) thrashers.emplace_back(thrash, 2 * llc);
+    if (options.threads == 0) {
+        std::fprintf(stderr, "warning: no thrasher threads, the warm phase runs without interference\n");
+    }
+
+    for (const Input& in : cold_inputs) {
+        evict(evict_buffer.get(), evict_bytes);
+        cold.add(timedStep(in));
+        controller.advance();
+    }
+
+    for (std::size_t i = 0; i < warm_inputs.size(); ++i) {
+        warm.add(timedStep(warm_inputs[i]));
+        if ((i + 1) % components == 0) controller.advance();
+    }
+
+    stop_thrashing.store(true);
+    for (std::thread& t : thrashers) t.join();
+
+    std::printf("RealtimeController<%lu>::step(), %s (counter overhead %lu subtracted)\n",
+                static_cast<unsigned long>(controller.capacity()), COUNTER_UNIT,
+                static_cast<unsigned long>(overhead));
+    std::printf("  LLC %lu KiB, %u thrasher thread(s), mlockall %s, SCHED_FIFO %s\n",
+                static_cast<unsigned long>(llc / 1024), options.threads,
+                status.memory_locked ? "yes" : "no", status.fifo_scheduling ? "yes" : "no");
+    std::printf("  %-28s %9s %9s %9s %9s\n", "phase", "max", "p99.9", "median", "samples");
+    print("cold (LLC evicted)", cold);
+    print(options.threads == 0 ? "warm (no interference)" : "warm (thrashers running)", warm);
+
+    const std::uint64_t allocations = decision_path_allocations.load();
+    const std::uint32_t worst = std::max(statistic(cold, options.check), statistic(warm, options.check));
+
+    std::printf("  decision-path allocations: %lu\n", static_cast<unsigned long>(allocations));
+    if (options.check == 0) {
+        std::printf("  worst case %lu vs bound %lu: ", static_cast<unsigned long>(worst),
+                    static_cast<unsigned long>(options.bound));
+    } else {
+        std::printf("  p%lu.%lu %lu vs bound %lu: ", static_cast<unsigned long>(options.check / 10),
+                    static_cast<unsigned long>(options.check % 10),
+                    static_cast<unsigned long>(worst), static_cast<unsigned long>(options.bound));
+    }
+
+    if (allocations != 0) {
+        std::printf("FAIL (allocation)\n");
+        return 2;
+    }
+    if (worst > options.bound) {
+        std::printf("FAIL\n");
+        return 1;
+    }
+    std::printf("PASS\n");
+    return 0;
+}
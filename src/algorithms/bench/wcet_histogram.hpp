@@ -0,0 +1,52 @@
+/**
+ * SYNAPSE - Bench WCET histogram
+ * ==============================
+ *
+ * Exact maximum plus percentiles over a bounded range of counter values,
+ * with no allocation, so it can sit next to the code being timed. Shared
+ * by the bench/ WCET probes.
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#ifndef SYNAPSE_BENCH_WCET_HISTOGRAM_HPP
+#define SYNAPSE_BENCH_WCET_HISTOGRAM_HPP
+
+#include <cstdint>
+
+namespace synapse {
+namespace bench {
+
+/**
+ * Max and percentiles; values >= Buckets share the last bucket (the
+ * maximum stays exact)
+ */
+template <std::uint32_t Buckets = 4096>
+struct Histogram {
+    static constexpr std::uint32_t BUCKETS = Buckets;
+
+    std::uint32_t counts[BUCKETS] = {};
+    std::uint32_t max = 0;
+    std::uint32_t total = 0;
+
+    void add(std::uint32_t value) {
+        if (value > max) max = value;
+        ++counts[value < BUCKETS ? value : BUCKETS - 1];
+        ++total;
+    }
+
+    std::uint32_t percentile(std::uint32_t per_mille) const {
+        std::uint64_t seen = 0;
+        for (std::uint32_t i = 0; i < BUCKETS; ++i) {
+            seen += counts[i];
+            if (seen * 1000 >= static_cast<std::uint64_t>(total) * per_mille) return i;
+        }
+        return BUCKETS - 1;
+    }
+};
+
+} // namespace bench
+} // namespace synapse
+
+#endif // SYNAPSE_BENCH_WCET_HISTOGRAM_HPP
@@ -0,0 +1,164 @@
+/**
+ * SYNAPSE Native Engine - C ABI implementation
+ *
+ * Thin adapters from synapse_capi.h onto balancing_algorithm.hpp.
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#define SYNAPSE_CAPI_BUILD
+#include "synapse_capi.h"
+
+#include "balancing_algorithm.hpp"
+
+
+using namespace synapse::neural;
+
+struct synapse_balancer {
+    HardwareSoftwareBalancer impl;
+    explicit synapse_balancer(double target_throughput) : impl(target_throughput) {}
+};
+
+namespace {
+
+template <typename Fn>
+int32_t guarded(Fn&& fn) {
+    try {
+        fn();
+        return SYNAPSE_OK;
+    } catch (...) {
+        return SYNAPSE_ERR_INTERNAL;
+    }
+}
+
+void toTelemetry(const synapse_telemetry& in, TelemetryData& out) {
+    out.cpu_usage = in.cpu_usage;
+    out.memory_usage = in.memory_usage;
+    out.io_latency_ms = in.io_latency_ms;
+    out.network_latency_ms = in.network_latency_ms;
+    out.error_rate = in.error_rate;
+    out.throughput = in.throughput;
+
+    out.temperature.reset();
+    if (in.flags & SYNAPSE_TELEMETRY_HAS_TEMPERATURE) out.temperature = in.temperature;
+    out.power_consumption.reset();
+    if (in.flags & SYNAPSE_TELEMETRY_HAS_POWER) out.power_consumption = in.power_consumption;
+}
+
+MitigationAction brakeAction(SeverityLevel severity) {
+    switch (severity) {
+        case SeverityLevel::QUARANTINE: return MitigationAction::QUARANTINE;
+        case SeverityLevel::CRITICAL: return MitigationAction::BRAKE;
+        case SeverityLevel::WARNING: return MitigationAction::THROTTLE;
+        default: return MitigationAction::NONE;
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+uint32_t synapse_capi_version(void) {
+    return SYNAPSE_CAPI_VERSION;
+}
+
+double synapse_idi_calculate(int32_t days, int32_t loc_changed, int32_t dependencies) {
+    return IDICalculator::calculate(days, loc_changed, dependencies);
+}
+
+int32_t synapse_idi_calculate_batch(const int32_t* days, const int32_t* loc_changed,
+                                    const int32_t* dependencies, size_t count,
+                                    double min_loc_factor, double* out_idi) {
+    if (count == 0) return SYNAPSE_OK;
+    if (!days || !loc_changed || !dependencies || !out_idi) return SYNAPSE_ERR_INVALID_ARGUMENT;
+
+    // Same operation order as IDICalculator::calculate, so results are bit-identical
+    for (size_t i = 0; i < count; ++i) {
+        double d = std::max(days[i], 0);
+        double l = std::max(std::max(loc_changed[i], 0) / 1000.0, min_loc_factor);
+        double dep = std::max(dependencies[i], 1) / 10.0;
+        out_idi[i] = d * l * dep;
+    }
+    return SYNAPSE_OK;
+}
+
+int32_t synapse_idi_severity_batch(const double* idi, size_t count, int32_t* out_severity) {
+    if (count == 0) return SYNAPSE_OK;
+    if (!idi || !out_severity) return SYNAPSE_ERR_INVALID_ARGUMENT;
+
+    return guarded([&] {
+        const RuntimeThresholds& thresholds = *ThresholdStore::defaultStore().current();
+        for (size_t i = 0; i < count; ++i) {
+            out_severity[i] = static_cast<int32_t>(IDICalculator::getSeverity(idi[i], thresholds));
+        }
+    });
+}
+
+double synapse_brake_throttle_level(double idi) {
+    double level = 0.0;
+    if (guarded([&] {
+            level = IDIBrake::calculateThrottleLevel(idi, *ThresholdStore::defaultStore().current());
+        }) != SYNAPSE_OK) {
+        return 0.0;  // Fail closed: full brake
+    }
+    return level;
+}
+
+int32_t synapse_brake_batch(const double* idi, size_t count, int32_t* out_action, double* out_throttle) {
+    if (count == 0) return SYNAPSE_OK;
+    if (!idi || !out_throttle) return SYNAPSE_ERR_INVALID_ARGUMENT;
+
+    return guarded([&] {
+        const RuntimeThresholds& thresholds = *ThresholdStore::defaultStore().current();
+        for (size_t i = 0; i < count; ++i) {
+            out_throttle[i] = IDIBrake::calculateThrottleLevel(idi[i], thresholds);
+            if (out_action) {
+                out_action[i] = static_cast<int32_t>(
+                    brakeAction(IDICalculator::getSeverity(idi[i], thresholds)));
+            }
+        }
+    });
+}
+
+synapse_balancer* synapse_balancer_create(double target_throughput) {
+    try {
+        return new synapse_balancer(target_throughput);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void synapse_balancer_destroy(synapse_balancer* balancer) {
+    delete balancer;
+}
+
+int32_t synapse_balancer_balance_batch(synapse_balancer* const* balancers,
+                                       const synapse_telemetry* telemetry,
+                                       const double* current_throttle,
+                                       size_t count,
+                                       synapse_decision* out) {
+    if (count == 0) return SYNAPSE_OK;
+    if (!balancers || !telemetry || !current_throttle || !out) return SYNAPSE_ERR_INVALID_ARGUMENT;
+    for (size_t i = 0; i < count; ++i) {
+        if (!balancers[i]) return SYNAPSE_ERR_INVALID_ARGUMENT;
+    }
+
+    return guarded([&] {
+        TelemetryData sample{};
+        for (size_t i = 0; i < count; ++i) {
+            toTelemetry(telemetry[i], sample);
+
+            double imbalance = 0.0;
+            BalancingDecision decision =
+                balancers[i]->impl.balanceDecision(sample, current_throttle[i], &imbalance);
+
+            out[i].action = static_cast<int32_t>(decision.action);
+            out[i].reserved = 0;
+            out[i].throttle_level = decision.throttle_level;
+            out[i].imbalance = imbalance;
+        }
+    });
+}
+
+} // extern "C"
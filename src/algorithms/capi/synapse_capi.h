@@ -0,0 +1,146 @@
+/**
+ * SYNAPSE Native Engine - Stable C ABI
+ * ====================================
+ *
+ * Plain-C entry points around the C++ IDI, brake and balancer engine,
+ * for P/Invoke (.NET) and other FFI callers. Batch functions work on
+ * caller-owned flat arrays: one call per portfolio, no per-item
+ * marshalling. No C++ exception ever crosses this boundary.
+ *
+ * Build (shared library):
+ *   g++ -std=c++17 -O2 -fPIC -shared -fvisibility=hidden \
+ *       -static-libstdc++ -static-libgcc -I.. synapse_capi.cpp -o libsynapse_native.so
+ *
+ * ABI rules: only fixed-width integers, doubles and opaque pointers;
+ * structs are append-only and versioned through SYNAPSE_CAPI_VERSION.
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#ifndef SYNAPSE_CAPI_H
+#define SYNAPSE_CAPI_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#  if defined(SYNAPSE_CAPI_BUILD)
+#    define SYNAPSE_API __declspec(dllexport)
+#  else
+#    define SYNAPSE_API __declspec(dllimport)
+#  endif
+#else
+#  define SYNAPSE_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SYNAPSE_CAPI_VERSION 1
+
+/* Status codes */
+#define SYNAPSE_OK 0
+#define SYNAPSE_ERR_INVALID_ARGUMENT -1
+#define SYNAPSE_ERR_INTERNAL -2
+
+/* Telemetry flags */
+#define SYNAPSE_TELEMETRY_HAS_TEMPERATURE 0x1u
+#define SYNAPSE_TELEMETRY_HAS_POWER 0x2u
+
+/**
+ * Telemetry sample (mirrors TelemetryData without the string id)
+ */
+typedef struct synapse_telemetry {
+    double cpu_usage;           /* 0-100 */
+    double memory_usage;        /* 0-100 */
+    double io_latency_ms;
+    double network_latency_ms;
+    double error_rate;          /* 0-1 */
+    double throughput;          /* requests/sec */
+    double temperature;         /* valid if SYNAPSE_TELEMETRY_HAS_TEMPERATURE */
+    double power_consumption;   /* valid if SYNAPSE_TELEMETRY_HAS_POWER */
+    uint32_t flags;
+    uint32_t reserved;
+} synapse_telemetry;
+
+/**
+ * Balancing decision; action uses MitigationAction ordinal values
+ */
+typedef struct synapse_decision {
+    int32_t action;
+    int32_t reserved;
+    double throttle_level;
+    double imbalance;           /* Smoothed (moving average) imbalance */
+} synapse_decision;
+
+typedef struct synapse_balancer synapse_balancer;
+
+/** Runtime ABI version; compare against SYNAPSE_CAPI_VERSION */
+SYNAPSE_API uint32_t synapse_capi_version(void);
+
+/* -------------------------------------------------------------------------
+ * IDI
+ * ------------------------------------------------------------------------- */
+
+SYNAPSE_API double synapse_idi_calculate(int32_t days, int32_t loc_changed, int32_t dependencies);
+
+/**
+ * out_idi[i] = IDI(days[i], loc_changed[i], dependencies[i])
+ *
+ * min_loc_factor floors the LoC/1000 factor: 0.0 reproduces
+ * IDICalculator::calculate, the .NET platform service uses 0.1.
+ */
+SYNAPSE_API int32_t synapse_idi_calculate_batch(const int32_t* days,
+                                                const int32_t* loc_changed,
+                                                const int32_t* dependencies,
+                                                size_t count,
+                                                double min_loc_factor,
+                                                double* out_idi);
+
+/** out_severity[i] = SeverityLevel ordinal of idi[i] */
+SYNAPSE_API int32_t synapse_idi_severity_batch(const double* idi, size_t count,
+                                               int32_t* out_severity);
+
+/* -------------------------------------------------------------------------
+ * IDI Brake
+ * ------------------------------------------------------------------------- */
+
+/** Throttle level for one IDI value; 0.0 (full brake) on internal error */
+SYNAPSE_API double synapse_brake_throttle_level(double idi);
+
+/**
+ * Brake decision per IDI value; out_action may be NULL
+ */
+SYNAPSE_API int32_t synapse_brake_batch(const double* idi, size_t count,
+                                        int32_t* out_action, double* out_throttle);
+
+/* -------------------------------------------------------------------------
+ * Hardware-Software Balancer
+ * ------------------------------------------------------------------------- */
+
+/**
+ * Returns NULL if the balancer cannot be constructed
+ */
+SYNAPSE_API synapse_balancer* synapse_balancer_create(double target_throughput);
+SYNAPSE_API void synapse_balancer_destroy(synapse_balancer* balancer);
+
+/**
+ * One balance() step per element: balancers[i] gets telemetry[i]
+ *
+ * The same balancer may appear more than once; steps run in array order.
+ * A NULL element fails the whole batch with SYNAPSE_ERR_INVALID_ARGUMENT
+ * before any balancer is stepped.
+ */
+SYNAPSE_API int32_t synapse_balancer_balance_batch(synapse_balancer* const* balancers,
+                                                   const synapse_telemetry* telemetry,
+                                                   const double* current_throttle,
+                                                   size_t count,
+                                                   synapse_decision* out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SYNAPSE_CAPI_H */
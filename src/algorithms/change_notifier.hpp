@@ -0,0 +1,184 @@
+/**
+ * SYNAPSE Neural Connection Layer - Edge-Triggered Change Notifier
+ * ================================================================
+ *
+ * balance() and the brake produce a MitigationResult on every sample,
+ * including the thousands that repeat the previous decision. The
+ * notifier remembers, per component, the last action and throttle level
+ * it let through and only surfaces transitions:
+ *
+ *   ChangeNotifier notifier;
+ *   if (auto change = notifier.observe(balancer.balance(telemetry, throttle))) {
+ *       publish(*change);
+ *   }
+ *
+ * Throttle levels are quantized to a step with a hysteresis band around
+ * each boundary, so a level hovering between two steps does not flap.
+ * Every component starts as NONE at full throttle (1.0): a healthy
+ * component produces no events at all.
+ *
+ * Use one notifier per result stream (balancer, brake, ...): the notifier
+ * compares successive results of one stream, and interleaving two
+ * streams would turn every sample into a transition.
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#ifndef SYNAPSE_CHANGE_NOTIFIER_HPP
+#define SYNAPSE_CHANGE_NOTIFIER_HPP
+
+#include "balancing_algorithm.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace synapse {
+namespace neural {
+
+// =============================================================================
+// CONFIGURATION
+// =============================================================================
+
+struct ChangeNotifierConfig {
+    // Throttle levels are reported as multiples of this step
+    double throttle_step = 0.05;
+
+    // Extra distance past the half-step boundary before the reported level
+    // moves (absolute throttle units; 0 = plain rounding)
+    double throttle_hysteresis = 0.01;
+
+    // Re-surface an unchanged state after this long (keep-alive for late
+    // subscribers); zero = never
+    std::chrono::system_clock::duration max_silence = std::chrono::system_clock::duration::zero();
+};
+
+enum class ChangeReason : std::uint8_t {
+    ACTION,      // Action differs from the last one surfaced
+    THROTTLE,    // Same action, throttle left its hysteresis band
+    HEARTBEAT    // Nothing changed for max_silence
+};
+
+inline const char* toString(ChangeReason reason) {
+    switch (reason) {
+        case ChangeReason::ACTION: return "action";
+        case ChangeReason::THROTTLE: return "throttle";
+        case ChangeReason::HEARTBEAT: return "heartbeat";
+    }
+    return "unknown";
+}
+
+/**
+ * One surfaced transition
+ */
+struct StateChange {
+    ChangeReason reason;
+    MitigationAction previous_action;
+    MitigationAction action;
+    double previous_throttle;   // Quantized, as last surfaced
+    double throttle;            // Quantized
+};
+
+// =============================================================================
+// CHANGE NOTIFIER
+// =============================================================================
+
+/**
+ * Per-component edge detector over a stream of results
+ *
+ * Not thread-safe: feed it from the thread that consumes the stream.
+ */
+class ChangeNotifier {
+private:
+    struct State {
+        MitigationAction action = MitigationAction::NONE;
+        std::int32_t level = 0;   // Throttle in steps
+        std::chrono::system_clock::time_point last_emitted{};
+    };
+
+    ChangeNotifierConfig config_;
+    double boundary_;   // Distance in steps that moves the level: 0.5 + hysteresis
+    std::int32_t full_level_;
+    std::unordered_map<std::string, State> states_;
+
+    std::uint64_t observed_ = 0;
+    std::uint64_t emitted_ = 0;
+
+    std::int32_t quantize(double throttle) const {
+        return static_cast<std::int32_t>(std::lround(throttle / config_.throttle_step));
+    }
+
+public:
+    explicit ChangeNotifier(const ChangeNotifierConfig& config = ChangeNotifierConfig{})
+        : config_(config),
+          boundary_(0.5 + config.throttle_hysteresis / config.throttle_step),
+          full_level_(quantize(1.0)) {}
+
+    /**
+     * Feed one result
+     *
+     * @return The transition to publish, or nullopt if nothing changed
+     */
+    std::optional<StateChange> observe(const std::string& component_id, MitigationAction action,
+                                       double throttle_level,
+                                       std::chrono::system_clock::time_point timestamp) {
+        ++observed_;
+
+        auto [it, inserted] = states_.try_emplace(component_id);
+        State& state = it->second;
+        if (inserted) {
+            state.level = full_level_;
+            state.last_emitted = timestamp;
+        }
+
+        const MitigationAction previous_action = state.action;
+        const std::int32_t previous_level = state.level;
+
+        std::optional<ChangeReason> reason;
+        if (action != state.action) {
+            reason = ChangeReason::ACTION;
+            state.action = action;
+            state.level = quantize(throttle_level);
+        } else if (std::abs(throttle_level / config_.throttle_step - state.level) > boundary_) {
+            reason = ChangeReason::THROTTLE;
+            state.level = quantize(throttle_level);
+        } else if (config_.max_silence != std::chrono::system_clock::duration::zero()
+                   && timestamp - state.last_emitted >= config_.max_silence) {
+            reason = ChangeReason::HEARTBEAT;
+        }
+
+        if (!reason) return std::nullopt;
+
+        state.last_emitted = timestamp;
+        ++emitted_;
+        return StateChange{*reason, previous_action, action,
+                           previous_level * config_.throttle_step,
+                           state.level * config_.throttle_step};
+    }
+
+    std::optional<StateChange> observe(const MitigationResult& result) {
+        return observe(result.component_id, result.action, result.throttle_level, result.timestamp);
+    }
+
+    /**
+     * Drop a component's state (it reports as new afterwards)
+     */
+    void forget(const std::string& component_id) { states_.erase(component_id); }
+
+    void clear() { states_.clear(); }
+
+    std::uint64_t observedTotal() const { return observed_; }
+    std::uint64_t emittedTotal() const { return emitted_; }
+    size_t componentCount() const { return states_.size(); }
+
+    const ChangeNotifierConfig& config() const { return config_; }
+};
+
+} // namespace neural
+} // namespace synapse
+
+#endif // SYNAPSE_CHANGE_NOTIFIER_HPP
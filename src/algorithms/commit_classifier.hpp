@@ -0,0 +1,286 @@
+/**
+ * SYNAPSE Neural Connection Layer - Commit Message Classifier
+ * ===========================================================
+ *
+ * Compiled form of CommitAnalyzer.get_commit_type / is_allowed_commit
+ * (idi_lock.py) for bulk history analysis:
+ *
+ *   commit::CommitClassifier classifier({"fix", "bugfix", "hotfix", "integration",
+ *                                        "merge", "revert", "ci"});
+ *   classifier.classify(messages.data(), messages.size(), out.data());
+ *   commit::LockOutcome o = commit::decide(out[i], commit::lockLevelFor(idi));
+ *
+ * The allow-list is compiled into one anchored DFA with case folding in
+ * its transition table. A single left-to-right pass over each message
+ * skips leading whitespace, runs the leading word through the DFA (which
+ * answers both "type is allowed" and "message starts with an allowed
+ * type") and then checks the `(scope)!:` tail, replacing the Python
+ * conventional-commit regex ^(\w+)(\(.+\))?!?: and the startswith loop.
+ *
+ * Python matches \w, strip() and lower() on Unicode; this pass is ASCII.
+ * Where that can change the answer (a non-ASCII character in leading
+ * position or ending the leading word) the message is classified
+ * UNDECIDED and the caller falls back to the Python path, so decisions
+ * stay identical.
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#ifndef SYNAPSE_COMMIT_CLASSIFIER_HPP
+#define SYNAPSE_COMMIT_CLASSIFIER_HPP
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace synapse {
+namespace neural {
+namespace commit {
+
+/**
+ * IDILockConfig lock levels and thresholds
+ */
+enum class LockLevel : std::uint8_t {
+    NONE = 0,
+    SOFT = 1,       // Warning only
+    HARD = 2,       // Only allowed commit types
+    TOTAL = 3       // No commits
+};
+
+struct LockThresholds {
+    double soft = 5.0;
+    double hard = 7.0;
+    double total = 10.0;
+};
+
+inline LockLevel lockLevelFor(double idi, const LockThresholds& t = LockThresholds()) {
+    if (idi >= t.total) return LockLevel::TOTAL;
+    if (idi >= t.hard) return LockLevel::HARD;
+    if (idi >= t.soft) return LockLevel::SOFT;
+    return LockLevel::NONE;
+}
+
+inline const char* toString(LockLevel level) {
+    switch (level) {
+        case LockLevel::NONE: return "none";
+        case LockLevel::SOFT: return "soft";
+        case LockLevel::HARD: return "hard";
+        case LockLevel::TOTAL: return "total";
+    }
+    return "none";
+}
+
+enum class CommitKind : std::uint8_t {
+    UNKNOWN = 0,    // No type: is_allowed_commit -> (False, "unknown")
+    ALLOWED = 1,    // Type on the allow-list
+    OTHER = 2,      // Conventional type not on the allow-list
+    UNDECIDED = 3   // Needs the Unicode-aware Python path
+};
+
+struct Classification {
+    CommitKind kind = CommitKind::UNKNOWN;
+    std::uint32_t type_begin = 0;          // Leading word in the message (conventional types)
+    std::uint32_t type_length = 0;
+    std::int32_t keyword = -1;             // Allow-list index when the type is a listed keyword
+
+    bool allowed() const { return kind == CommitKind::ALLOWED; }
+};
+
+class CommitClassifier {
+private:
+    static constexpr std::uint16_t DEAD = 0;
+    static constexpr std::uint16_t START = 1;
+
+    std::vector<std::string> keywords_;
+    std::vector<std::uint16_t> next_;      // state * 256 + byte
+    std::vector<std::int32_t> accept_;     // Keyword ending in state, or -1
+
+    static bool isWord(unsigned char ch) {
+        return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9') || ch == '_';
+    }
+
+    /**
+     * Characters str.strip() removes that are ASCII
+     */
+    static bool isSpace(unsigned char ch) {
+        return ch == ' ' || (ch >= '\t' && ch <= '\r') || (ch >= 0x1c && ch <= 0x1f);
+    }
+
+    static unsigned char lower(unsigned char ch) {
+        return ch >= 'A' && ch <= 'Z' ? static_cast<unsigned char>(ch - 'A' + 'a') : ch;
+    }
+
+    static bool startsWithMerge(const unsigned char* m, size_t n) {
+        static const char word[] = "merge";
+        if (n < 5) return false;
+        for (size_t k = 0; k < 5; ++k) {
+            if (lower(m[k]) != static_cast<unsigned char>(word[k])) return false;
+        }
+        return true;
+    }
+
+    std::uint16_t addState() {
+        next_.resize(next_.size() + 256, DEAD);
+        accept_.push_back(-1);
+        return static_cast<std::uint16_t>(accept_.size() - 1);
+    }
+
+    /**
+     * `(.+)` then `!?:` starting at the '(' at `open`, on the same line
+     */
+    static bool scopeTail(std::string_view m, size_t open) {
+        for (size_t k = open + 1; k < m.size(); ++k) {
+            char ch = m[k];
+            if (ch == '\n') return false;
+            if (ch != ')' || k == open + 1) continue;
+            if (k + 1 < m.size() && m[k + 1] == ':') return true;
+            if (k + 2 < m.size() && m[k + 1] == '!' && m[k + 2] == ':') return true;
+        }
+        return false;
+    }
+
+public:
+    /**
+     * Compile the allow-list (IDILockConfig.ALLOWED_COMMIT_TYPES); like
+     * the startswith loop, the fallback reports the first listed keyword
+     * that matches.
+     * Throws std::invalid_argument for an empty or non-ASCII keyword.
+     */
+    explicit CommitClassifier(const std::vector<std::string>& keywords) : keywords_(keywords) {
+        addState();                                   // DEAD
+        addState();                                   // START
+
+        for (size_t k = 0; k < keywords_.size(); ++k) {
+            const std::string& keyword = keywords_[k];
+            if (keyword.empty()) throw std::invalid_argument("commit_classifier: empty keyword");
+
+            std::uint16_t state = START;
+            for (unsigned char ch : keyword) {
+                if (ch >= 0x80) throw std::invalid_argument("commit_classifier: non-ASCII keyword " + keyword);
+                ch = lower(ch);
+                std::uint16_t to = next_[state * 256 + ch];
+                if (to == DEAD) {
+                    to = addState();
+                    next_[state * 256 + ch] = to;
+                    if (ch >= 'a' && ch <= 'z') next_[state * 256 + (ch - 'a' + 'A')] = to;
+                }
+                state = to;
+            }
+            if (accept_[state] < 0) accept_[state] = static_cast<std::int32_t>(k);
+            if (accept_.size() > UINT16_MAX) throw std::invalid_argument("commit_classifier: allow-list too large");
+        }
+    }
+
+    const std::string& keyword(std::int32_t index) const { return keywords_[static_cast<size_t>(index)]; }
+
+    /**
+     * One message; `message` may include the body
+     */
+    Classification classify(std::string_view message) const {
+        Classification c;
+        const auto* m = reinterpret_cast<const unsigned char*>(message.data());
+        const size_t n = message.size();
+
+        size_t i = 0;
+        while (i < n && isSpace(m[i])) ++i;
+        if (i < n && m[i] >= 0x80) {
+            c.kind = CommitKind::UNDECIDED;
+            return c;
+        }
+
+        // Leading word through the DFA, remembering the first listed
+        // keyword that is a prefix for the startswith fallback
+        std::uint16_t state = START;
+        std::int32_t prefix = -1;
+        auto step = [&](unsigned char ch) {
+            state = next_[state * 256 + ch];
+            std::int32_t k = accept_[state];
+            if (k >= 0 && (prefix < 0 || k < prefix)) prefix = k;
+        };
+
+        size_t j = i;
+        for (; j < n && isWord(m[j]); ++j) {
+            if (state != DEAD) step(m[j]);
+        }
+        if (j < n && m[j] >= 0x80) {
+            c.kind = CommitKind::UNDECIDED;
+            return c;
+        }
+        const std::uint16_t word_state = state;
+
+        // Keywords with punctuation ("ci-cd") continue past the word
+        for (size_t k = j; k < n && state != DEAD; ++k) {
+            if (m[k] >= 0x80) {
+                c.kind = CommitKind::UNDECIDED;         // lower() may fold it to ASCII
+                return c;
+            }
+            step(m[k]);
+        }
+
+        bool conventional = false;
+        if (j > i && j < n) {
+            if (m[j] == ':') conventional = true;
+            else if (m[j] == '!') conventional = j + 1 < n && m[j + 1] == ':';
+            else if (m[j] == '(') conventional = scopeTail(message, j);
+        }
+
+        if (conventional) {
+            c.type_begin = static_cast<std::uint32_t>(i);
+            c.type_length = static_cast<std::uint32_t>(j - i);
+            c.keyword = accept_[word_state];
+            c.kind = c.keyword >= 0 ? CommitKind::ALLOWED : CommitKind::OTHER;
+        } else if (prefix >= 0) {
+            c.keyword = prefix;
+            c.kind = CommitKind::ALLOWED;
+        } else if (startsWithMerge(m + i, n - i)) {
+            c.type_begin = static_cast<std::uint32_t>(i);   // 'merge' even when not allowed
+            c.type_length = 5;
+            c.kind = CommitKind::OTHER;
+        }
+        return c;
+    }
+
+    void classify(const std::string_view* messages, size_t count, Classification* out) const {
+        for (size_t i = 0; i < count; ++i) out[i] = classify(messages[i]);
+    }
+
+    /**
+     * The type string is_allowed_commit() reports: the lowercased
+     * conventional type, the matched keyword, or "unknown"
+     */
+    std::string typeName(std::string_view message, const Classification& c) const {
+        if (c.kind == CommitKind::UNKNOWN || c.kind == CommitKind::UNDECIDED) return "unknown";
+        if (c.type_length == 0) return keyword(c.keyword);
+
+        std::string type(message.substr(c.type_begin, c.type_length));
+        for (char& ch : type) ch = static_cast<char>(lower(static_cast<unsigned char>(ch)));
+        return type;
+    }
+};
+
+/**
+ * CommitAnalyzer.analyze_commit's allowed / blocked outcome
+ */
+struct LockOutcome {
+    bool allowed;
+    LockLevel level;
+};
+
+inline LockOutcome decide(const Classification& c, LockLevel level) {
+    switch (level) {
+        case LockLevel::TOTAL: return {false, level};
+        case LockLevel::HARD: return {c.allowed(), level};
+        case LockLevel::NONE:
+        case LockLevel::SOFT: break;
+    }
+    return {true, level};
+}
+
+} // namespace commit
+} // namespace neural
+} // namespace synapse
+
+#endif // SYNAPSE_COMMIT_CLASSIFIER_HPP
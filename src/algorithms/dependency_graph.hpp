@@ -0,0 +1,394 @@
+/**
+ * SYNAPSE Neural Connection Layer - Dependency Graph
+ * ==================================================
+ *
+ * Component dependencies as a compact CSR graph, with backpressure
+ * propagation: when a provider is braked or quarantined, its consumers
+ * are throttled to match instead of each component being throttled in
+ * isolation.
+ *
+ *   DependencyGraph graph(components, edges);   // edge {u, v}: v depends on u
+ *   graph.apply(u, IDIBrake::applyBrake(...));
+ *   graph.propagate([&](ComponentHandle c, double before, double after) {
+ *       throttle(c, after);
+ *   });
+ *   IDICalculator::calculate(days, loc, graph.dependencyCount(c));
+ *
+ * Effective throttle of a component: the minimum of its own throttle
+ * (0 when quarantined) and inherit(effective) of every provider, where
+ * inherit(x) = 1 - coupling * (1 - x). coupling = 1 passes a brake on
+ * unchanged; smaller values damp it per hop.
+ *
+ * Cycles are condensed into strongly connected components at build time,
+ * so propagation walks a DAG in topological order: a component is
+ * recomputed once per propagate(), after all its providers, and only if
+ * one of them (or its own state) changed. Releasing a brake therefore
+ * lifts the downstream throttle correctly, and propagate() touches only
+ * the subgraph whose value actually moves. Members of a cycle are
+ * recomputed together, so an update inside a large cycle costs the
+ * whole cycle.
+ *
+ * Memory: 4 bytes per edge in each direction plus about 50 bytes per
+ * component; 1M components and 10M edges take about 130 MB.
+ *
+ * The topology is fixed at construction; rebuild the graph when edges
+ * change. Not thread-safe: one thread owns updates and propagate().
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#ifndef SYNAPSE_DEPENDENCY_GRAPH_HPP
+#define SYNAPSE_DEPENDENCY_GRAPH_HPP
+
+#include "balancing_algorithm.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace synapse {
+namespace neural {
+
+using DependencyEdge = std::pair<ComponentHandle, ComponentHandle>;   // {provider, consumer}
+
+class DependencyGraph {
+private:
+    using Index = std::uint32_t;
+    static constexpr Index NONE = static_cast<Index>(-1);
+
+    // Topology (CSR, both directions)
+    std::vector<Index> out_offsets_, out_targets_;   // provider -> consumers
+    std::vector<Index> in_offsets_, in_sources_;     // consumer -> providers
+
+    // Condensation: scc_[v] is a topological rank (providers first)
+    std::vector<Index> scc_;
+    std::vector<Index> scc_offsets_, scc_members_;
+
+    // State
+    std::vector<double> own_;            // Per component: own throttle
+    std::vector<std::uint8_t> quarantined_;
+    std::vector<double> effective_;
+    std::vector<Index> limited_by_;      // Component whose own value set effective_
+
+    double coupling_;
+
+    // Pending SCCs, lowest rank first
+    std::priority_queue<Index, std::vector<Index>, std::greater<Index>> pending_;
+    std::vector<std::uint8_t> queued_;
+    std::vector<std::pair<double, Index>> before_;   // Scratch: one SCC's previous state
+
+    static void buildCsr(size_t nodes, const std::vector<DependencyEdge>& edges, bool forward,
+                         std::vector<Index>& offsets, std::vector<Index>& targets) {
+        offsets.assign(nodes + 1, 0);
+        for (const DependencyEdge& e : edges) ++offsets[(forward ? e.first : e.second) + 1];
+        for (size_t i = 0; i < nodes; ++i) offsets[i + 1] += offsets[i];
+
+        targets.resize(edges.size());
+        std::vector<Index> cursor(offsets.begin(), offsets.end() - 1);
+        for (const DependencyEdge& e : edges) {
+            Index from = forward ? e.first : e.second;
+            targets[cursor[from]++] = forward ? e.second : e.first;
+        }
+    }
+
+    /**
+     * Tarjan's SCC algorithm, iterative (no recursion depth limit)
+     *
+     * Tarjan emits SCCs sinks first; ranks are reversed so that every
+     * provider SCC ranks below its consumers.
+     */
+    void condense() {
+        const size_t n = own_.size();
+        std::vector<Index> index(n, NONE), low(n, 0), stack;
+        std::vector<std::uint8_t> on_stack(n, 0);
+        std::vector<std::pair<Index, Index>> frames;   // {node, next edge}
+        std::vector<Index> emitted(n, NONE);
+        Index next_index = 0, scc_count = 0;
+
+        for (Index root = 0; root < n; ++root) {
+            if (index[root] != NONE) continue;
+            frames.push_back({root, out_offsets_[root]});
+            index[root] = low[root] = next_index++;
+            stack.push_back(root);
+            on_stack[root] = 1;
+
+            while (!frames.empty()) {
+                auto& [v, edge] = frames.back();
+                if (edge < out_offsets_[v + 1]) {
+                    Index w = out_targets_[edge++];
+                    if (index[w] == NONE) {
+                        index[w] = low[w] = next_index++;
+                        stack.push_back(w);
+                        on_stack[w] = 1;
+                        frames.push_back({w, out_offsets_[w]});
+                    } else if (on_stack[w]) {
+                        low[v] = std::min(low[v], index[w]);
+                    }
+                    continue;
+                }
+
+                Index done = v;
+                frames.pop_back();
+                if (!frames.empty()) {
+                    Index parent = frames.back().first;
+                    low[parent] = std::min(low[parent], low[done]);
+                }
+                if (low[done] == index[done]) {
+                    Index w;
+                    do {
+                        w = stack.back();
+                        stack.pop_back();
+                        on_stack[w] = 0;
+                        emitted[w] = scc_count;
+                    } while (w != done);
+                    ++scc_count;
+                }
+            }
+        }
+
+        scc_.resize(n);
+        for (Index v = 0; v < n; ++v) scc_[v] = scc_count - 1 - emitted[v];
+
+        scc_offsets_.assign(scc_count + 1, 0);
+        for (Index v = 0; v < n; ++v) ++scc_offsets_[scc_[v] + 1];
+        for (Index c = 0; c < scc_count; ++c) scc_offsets_[c + 1] += scc_offsets_[c];
+        scc_members_.resize(n);
+        std::vector<Index> cursor(scc_offsets_.begin(), scc_offsets_.end() - 1);
+        for (Index v = 0; v < n; ++v) scc_members_[cursor[scc_[v]]++] = v;
+    }
+
+    double inherit(double provider) const { return 1.0 - coupling_ * (1.0 - provider); }
+
+    double ownValue(Index v) const { return quarantined_[v] ? 0.0 : own_[v]; }
+
+    void schedule(Index scc) {
+        if (queued_[scc]) return;
+        queued_[scc] = 1;
+        pending_.push(scc);
+    }
+
+    /**
+     * Spread values around a cycle, lowest first (Dijkstra order: inherit()
+     * never lowers a value, so the lowest member is final when popped)
+     */
+    void settleCycle(Index c) {
+        using Entry = std::pair<double, Index>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+        for (Index m = scc_offsets_[c]; m < scc_offsets_[c + 1]; ++m) {
+            Index v = scc_members_[m];
+            heap.push({effective_[v], v});
+        }
+
+        while (!heap.empty()) {
+            auto [value, v] = heap.top();
+            heap.pop();
+            if (value != effective_[v]) continue;   // Stale entry
+
+            const double inherited = inherit(value);
+            for (Index e = out_offsets_[v]; e < out_offsets_[v + 1]; ++e) {
+                Index w = out_targets_[e];
+                if (scc_[w] != c || inherited >= effective_[w]) continue;
+                effective_[w] = inherited;
+                limited_by_[w] = limited_by_[v];
+                heap.push({inherited, w});
+            }
+        }
+    }
+
+public:
+    /**
+     * @param components Number of components (handles 0 .. components-1)
+     * @param edges      {provider, consumer}: consumer depends on provider
+     * @param coupling   Share of a provider's brake passed to consumers (0-1)
+     * @throws std::out_of_range on an edge endpoint >= components
+     */
+    DependencyGraph(size_t components, const std::vector<DependencyEdge>& edges,
+                    double coupling = 1.0)
+        : own_(components, 1.0),
+          quarantined_(components, 0),
+          coupling_(std::clamp(coupling, 0.0, 1.0)) {
+        for (const DependencyEdge& e : edges) {
+            if (e.first >= components || e.second >= components) {
+                throw std::out_of_range("DependencyGraph: edge endpoint out of range");
+            }
+        }
+
+        buildCsr(components, edges, true, out_offsets_, out_targets_);
+        buildCsr(components, edges, false, in_offsets_, in_sources_);
+        condense();
+
+        effective_.assign(components, 1.0);
+        limited_by_.resize(components);
+        for (Index v = 0; v < components; ++v) limited_by_[v] = v;
+        queued_.assign(scc_offsets_.size() - 1, 0);
+    }
+
+    // -------------------------------------------------------------------------
+    // Topology
+    // -------------------------------------------------------------------------
+
+    size_t componentCount() const { return own_.size(); }
+    size_t edgeCount() const { return out_targets_.size(); }
+    size_t sccCount() const { return queued_.size(); }
+
+    /**
+     * Number of providers: the `dependencies` argument of IDICalculator
+     */
+    int dependencyCount(ComponentHandle c) const {
+        return static_cast<int>(in_offsets_[c + 1] - in_offsets_[c]);
+    }
+
+    int dependentCount(ComponentHandle c) const {
+        return static_cast<int>(out_offsets_[c + 1] - out_offsets_[c]);
+    }
+
+    /**
+     * fn(ComponentHandle consumer) for every direct dependent
+     */
+    template <typename Fn>
+    void forEachDependent(ComponentHandle c, Fn&& fn) const {
+        for (Index e = out_offsets_[c]; e < out_offsets_[c + 1]; ++e) fn(out_targets_[e]);
+    }
+
+    template <typename Fn>
+    void forEachProvider(ComponentHandle c, Fn&& fn) const {
+        for (Index e = in_offsets_[c]; e < in_offsets_[c + 1]; ++e) fn(in_sources_[e]);
+    }
+
+    bool sameCycle(ComponentHandle a, ComponentHandle b) const { return scc_[a] == scc_[b]; }
+
+    /**
+     * Topological rank of c's strongly connected component: every
+     * provider outside c's cycle ranks lower (0 .. sccCount()-1)
+     */
+    std::uint32_t rankOf(ComponentHandle c) const { return scc_[c]; }
+
+    /**
+     * fn(ComponentHandle member) for every component of the SCC at `rank`
+     */
+    template <typename Fn>
+    void forEachInRank(std::uint32_t rank, Fn&& fn) const {
+        for (Index m = scc_offsets_[rank]; m < scc_offsets_[rank + 1]; ++m) fn(scc_members_[m]);
+    }
+
+    // -------------------------------------------------------------------------
+    // Updates
+    // -------------------------------------------------------------------------
+
+    /**
+     * Set a component's own throttle (takes effect on propagate())
+     */
+    void setThrottle(ComponentHandle c, double throttle) {
+        throttle = std::clamp(throttle, 0.0, 1.0);
+        if (own_[c] == throttle) return;
+        own_[c] = throttle;
+        schedule(scc_[c]);
+    }
+
+    void setQuarantined(ComponentHandle c, bool quarantined) {
+        if (quarantined_[c] == static_cast<std::uint8_t>(quarantined)) return;
+        quarantined_[c] = quarantined;
+        schedule(scc_[c]);
+    }
+
+    /**
+     * Take a brake / balance result as the component's own state
+     */
+    void apply(ComponentHandle c, const MitigationResult& result) {
+        setQuarantined(c, result.action == MitigationAction::QUARANTINE);
+        setThrottle(c, result.throttle_level);
+    }
+
+    /**
+     * Recompute the effective throttle downstream of every update
+     *
+     * on_change(ComponentHandle, double before, double after) is called
+     * for each component whose effective throttle moved.
+     *
+     * @return Number of components whose effective throttle moved
+     */
+    template <typename OnChange>
+    size_t propagate(OnChange&& on_change) {
+        size_t changed = 0;
+
+        while (!pending_.empty()) {
+            Index c = pending_.top();
+            pending_.pop();
+            queued_[c] = 0;
+
+            const Index first = scc_offsets_[c], last = scc_offsets_[c + 1];
+            before_.clear();
+            for (Index m = first; m < last; ++m) {
+                Index v = scc_members_[m];
+                before_.push_back({effective_[v], limited_by_[v]});
+
+                // Own value and providers outside the cycle (already final)
+                double value = ownValue(v);
+                Index source = v;
+                for (Index e = in_offsets_[v]; e < in_offsets_[v + 1]; ++e) {
+                    Index u = in_sources_[e];
+                    if (scc_[u] == c) continue;
+                    double inherited = inherit(effective_[u]);
+                    if (inherited < value) {
+                        value = inherited;
+                        source = limited_by_[u];
+                    }
+                }
+                effective_[v] = value;
+                limited_by_[v] = source;
+            }
+            if (last - first > 1) settleCycle(c);
+
+            for (Index m = first; m < last; ++m) {
+                Index v = scc_members_[m];
+                const double before = before_[m - first].first;
+                if (effective_[v] == before && limited_by_[v] == before_[m - first].second) continue;
+
+                if (effective_[v] != before) {
+                    on_change(static_cast<ComponentHandle>(v), before, effective_[v]);
+                    ++changed;
+                }
+                for (Index e = out_offsets_[v]; e < out_offsets_[v + 1]; ++e) {
+                    Index w = scc_[out_targets_[e]];
+                    if (w != c) schedule(w);
+                }
+            }
+        }
+
+        return changed;
+    }
+
+    size_t propagate() {
+        return propagate([](ComponentHandle, double, double) {});
+    }
+
+    // -------------------------------------------------------------------------
+    // State
+    // -------------------------------------------------------------------------
+
+    double ownThrottle(ComponentHandle c) const { return own_[c]; }
+    bool isQuarantined(ComponentHandle c) const { return quarantined_[c] != 0; }
+
+    /**
+     * Throttle after backpressure (as of the last propagate())
+     */
+    double effectiveThrottle(ComponentHandle c) const { return effective_[c]; }
+
+    /**
+     * Component whose own throttle or quarantine sets c's effective
+     * throttle (c itself when nothing upstream is more restrictive)
+     */
+    ComponentHandle limitedBy(ComponentHandle c) const { return limited_by_[c]; }
+
+    bool hasPendingUpdates() const { return !pending_.empty(); }
+};
+
+} // namespace neural
+} // namespace synapse
+
+#endif // SYNAPSE_DEPENDENCY_GRAPH_HPP
@@ -0,0 +1,384 @@
+/**
+ * SYNAPSE Neural Connection Layer - Embedded Profile
+ * ==================================================
+ *
+ * Bare-metal build of the IDI brake, HW-SW balancer, neural pruning and
+ * PID throttling for firmware without a heap:
+ *
+ *   - no heap, no exceptions, no RTTI, no locks (single execution context)
+ *   - fixed-capacity inline buffers; history window sized at compile time
+ *   - integer component IDs (table index) instead of strings
+ *   - monotonic tick counter supplied by the caller instead of a clock
+ *   - depends on balancing_types.hpp and fixed_point.hpp only
+ *
+ * Define SYNAPSE_EMBEDDED_PROFILE for the whole firmware build: including
+ * balancing_algorithm.hpp then fails to compile instead of silently
+ * pulling in the hosted library.
+ *
+ * Compile-time configuration (defaults in brackets):
+ *   SYNAPSE_EMBEDDED_MAX_COMPONENTS  component table size       [16]
+ *   SYNAPSE_EMBEDDED_HISTORY_WINDOW  moving-average window      [10]
+ *   SYNAPSE_EMBEDDED_NO_PID          strip the PID controller
+ *   SYNAPSE_EMBEDDED_NO_PRUNING      strip quarantine / restore
+ *
+ * Footprint budget for the default EmbeddedEngine<Q16_16> (Cortex-M0,
+ * -Os, gc-sections, libgcc helpers included): 4 KiB flash, 1.5 KiB RAM
+ * (about 90 bytes per component slot plus one shared thresholds copy).
+ * bench/embedded_footprint.cpp enforces the RAM side with static_asserts
+ * and bench/check_footprint.sh the flash side.
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#ifndef SYNAPSE_EMBEDDED_BALANCER_HPP
+#define SYNAPSE_EMBEDDED_BALANCER_HPP
+
+#include "balancing_types.hpp"
+#include "fixed_point.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#ifndef SYNAPSE_EMBEDDED_MAX_COMPONENTS
+#define SYNAPSE_EMBEDDED_MAX_COMPONENTS 16
+#endif
+
+#ifndef SYNAPSE_EMBEDDED_HISTORY_WINDOW
+#define SYNAPSE_EMBEDDED_HISTORY_WINDOW 10
+#endif
+
+namespace synapse {
+namespace neural {
+namespace embedded {
+
+using fixed::BasicBalancerScoring;
+using fixed::BasicDecision;
+using fixed::BasicIDIBrake;
+using fixed::BasicPIDController;
+using fixed::BasicTelemetry;
+using fixed::BasicThresholds;
+using fixed::DEFAULT_BASIC_THRESHOLDS;
+using fixed::num;
+
+/**
+ * Component handle: index into the engine's table
+ */
+using ComponentId = std::uint16_t;
+constexpr ComponentId INVALID_COMPONENT = 0xFFFF;
+
+// =============================================================================
+// INLINE RING
+// =============================================================================
+
+/**
+ * Fixed-capacity ring buffer with inline storage
+ *
+ * push() overwrites the oldest entry once full; [0] is the oldest.
+ */
+template <typename V, std::size_t Capacity>
+class InlineRing {
+    static_assert(Capacity > 0, "InlineRing needs a non-zero capacity");
+
+private:
+    using index_type = std::conditional_t<(Capacity < 256), std::uint8_t, std::size_t>;
+
+    V items_[Capacity] = {};
+    index_type head_ = 0;   // Next write position
+    index_type size_ = 0;
+
+public:
+    void push(const V& value) {
+        items_[head_] = value;
+        head_ = static_cast<index_type>(head_ + 1 == Capacity ? 0 : head_ + 1);
+        if (size_ < Capacity) ++size_;
+    }
+
+    const V& operator[](std::size_t i) const {
+        std::size_t index = head_ + Capacity - size_ + i;
+        return items_[index >= Capacity ? index - Capacity : index];
+    }
+
+    const V& back() const { return (*this)[size_ - 1]; }
+
+    std::size_t size() const { return size_; }
+    bool full() const { return size_ == Capacity; }
+    static constexpr std::size_t capacity() { return Capacity; }
+
+    void clear() {
+        head_ = 0;
+        size_ = 0;
+    }
+};
+
+// =============================================================================
+// EMBEDDED BALANCER
+// =============================================================================
+
+/**
+ * HardwareSoftwareBalancer's smoothing rule over an inline window
+ *
+ * Returns the raw imbalance until Window samples have been seen, then
+ * the mean of the last Window (summed oldest first, as the original).
+ */
+template <typename T, std::size_t Window>
+class SmoothingWindow {
+private:
+    InlineRing<T, Window> history_;
+
+public:
+    T push(T imbalance) {
+        history_.push(imbalance);
+        if (!history_.full()) return imbalance;
+
+        T sum = num<T>(0.0);
+        for (std::size_t i = 0; i < Window; ++i) sum += history_[i];
+        return fixed::Num<T>::divInt(sum, static_cast<int>(Window));
+    }
+
+    void reset() { history_.clear(); }
+};
+
+template <typename T>
+struct EmbeddedDecision {
+    MitigationAction action;
+    T throttle_level;
+    T imbalance;   // Smoothed
+};
+
+/**
+ * HardwareSoftwareBalancer for a single component, inline history
+ */
+template <typename T = fixed::Q16_16, std::size_t Window = SYNAPSE_EMBEDDED_HISTORY_WINDOW>
+class EmbeddedBalancer {
+private:
+    BasicBalancerScoring<T> scoring_;
+    SmoothingWindow<T, Window> window_;
+
+public:
+    constexpr explicit EmbeddedBalancer(T target_throughput = num<T>(1000.0),
+                                        const BasicThresholds<T>& thresholds = DEFAULT_BASIC_THRESHOLDS<T>)
+        : scoring_(target_throughput, thresholds) {}
+
+    EmbeddedDecision<T> balance(const BasicTelemetry<T>& telemetry, T current_throttle) {
+        T hw = scoring_.hardwareCapacity(telemetry);
+        T sw = scoring_.softwareDemand(telemetry);
+        T avg = window_.push(scoring_.imbalance(hw, sw));
+        BasicDecision<T> decision = scoring_.decide(avg, current_throttle);
+        return {decision.action, decision.throttle_level, avg};
+    }
+
+    const BasicBalancerScoring<T>& scoring() const { return scoring_; }
+    void reset() { window_.reset(); }
+};
+
+// =============================================================================
+// NEURAL PRUNING (tick based)
+// =============================================================================
+
+#if !defined(SYNAPSE_EMBEDDED_NO_PRUNING)
+
+/**
+ * NeuralPruning over T with a caller-supplied monotonic tick counter
+ */
+template <typename T>
+struct BasicNeuralPruning {
+    static constexpr bool shouldPrune(T idi, T error_rate, T health_score,
+                                      bool has_temperature, T temperature,
+                                      const BasicThresholds<T>& t = DEFAULT_BASIC_THRESHOLDS<T>) {
+        if (idi >= t.idi_quarantine) return true;
+        if (error_rate >= num<T>(0.05)) return true;
+        if (has_temperature && temperature >= t.temperature_shutdown) return true;
+        return health_score < num<T>(20.0);
+    }
+
+    /**
+     * @param min_ticks Minimum quarantine time in caller ticks (wrap-safe)
+     */
+    static constexpr bool canRestore(T idi, T health_score, std::uint32_t quarantined_at,
+                                     std::uint32_t now, std::uint32_t min_ticks,
+                                     const BasicThresholds<T>& t = DEFAULT_BASIC_THRESHOLDS<T>) {
+        if (idi >= t.idi_warning) return false;
+        if (health_score < num<T>(70.0)) return false;
+        return now - quarantined_at >= min_ticks;
+    }
+};
+
+#endif // SYNAPSE_EMBEDDED_NO_PRUNING
+
+// =============================================================================
+// EMBEDDED ENGINE
+// =============================================================================
+
+template <typename T>
+struct ComponentInput {
+    BasicTelemetry<T> telemetry;
+    T idi;
+    T health_score;
+};
+
+template <typename T>
+struct EngineResult {
+    MitigationAction action;   // Most severe of brake / balance / pruning
+    T throttle_level;          // Combined: min(brake, balance), 0 when quarantined
+    T imbalance;
+    bool quarantined;
+};
+
+/**
+ * Per-component brake + balance + pruning over a fixed-size table
+ *
+ * Single execution context: call tick() from one loop (or one ISR
+ * priority) only. Nothing allocates; add() reports a full table with
+ * INVALID_COMPONENT instead of throwing.
+ */
+template <typename T = fixed::Q16_16,
+          std::size_t MaxComponents = SYNAPSE_EMBEDDED_MAX_COMPONENTS,
+          std::size_t Window = SYNAPSE_EMBEDDED_HISTORY_WINDOW>
+class EmbeddedEngine {
+    static_assert(MaxComponents > 0 && MaxComponents < INVALID_COMPONENT,
+                  "MaxComponents must fit ComponentId");
+
+private:
+    struct Slot {
+        SmoothingWindow<T, Window> window;
+        T throttle_level = num<T>(1.0);
+        T idi = num<T>(0.0);              // Last setIntegrationState()
+        T health_score = num<T>(100.0);
+#if !defined(SYNAPSE_EMBEDDED_NO_PID)
+        BasicPIDController<T> pid;
+#endif
+#if !defined(SYNAPSE_EMBEDDED_NO_PRUNING)
+        std::uint32_t quarantined_at = 0;
+        bool quarantined = false;
+#endif
+    };
+
+    BasicBalancerScoring<T> scoring_;   // Shared: one thresholds copy for the table
+    std::uint32_t min_quarantine_ticks_;
+    ComponentId count_ = 0;
+    Slot slots_[MaxComponents];
+
+    static MitigationAction moreSevere(MitigationAction a, MitigationAction b) {
+        auto rank = [](MitigationAction action) {
+            switch (action) {
+                case MitigationAction::QUARANTINE: return 4;
+                case MitigationAction::BRAKE: return 3;
+                case MitigationAction::THROTTLE: return 2;
+                case MitigationAction::ALERT: return 1;
+                default: return 0;
+            }
+        };
+        return rank(b) > rank(a) ? b : a;
+    }
+
+public:
+    /**
+     * @param min_quarantine_ticks Minimum time in quarantine, in tick() `now` units
+     */
+    constexpr explicit EmbeddedEngine(std::uint32_t min_quarantine_ticks = 3600,
+                                      T target_throughput = num<T>(1000.0),
+                                      const BasicThresholds<T>& thresholds = DEFAULT_BASIC_THRESHOLDS<T>)
+        : scoring_(target_throughput, thresholds), min_quarantine_ticks_(min_quarantine_ticks) {}
+
+    /**
+     * Register a component
+     *
+     * @return Its ID, or INVALID_COMPONENT when the table is full
+     */
+    ComponentId add() {
+        if (count_ == MaxComponents) return INVALID_COMPONENT;
+        slots_[count_] = Slot{};
+        return count_++;
+    }
+
+    std::size_t size() const { return count_; }
+    static constexpr std::size_t capacity() { return MaxComponents; }
+
+    /**
+     * Store the slow-moving inputs used by tick(id, telemetry, now)
+     */
+    void setIntegrationState(ComponentId id, T idi, T health_score) {
+        if (id >= count_) return;
+        slots_[id].idi = idi;
+        slots_[id].health_score = health_score;
+    }
+
+    /**
+     * tick() with the IDI and health score from setIntegrationState()
+     */
+    EngineResult<T> tick(ComponentId id, const BasicTelemetry<T>& telemetry, std::uint32_t now) {
+        if (id >= count_) return {MitigationAction::NONE, num<T>(0.0), num<T>(0.0), false};
+        return tick(id, ComponentInput<T>{telemetry, slots_[id].idi, slots_[id].health_score}, now);
+    }
+
+    /**
+     * One control step for a component
+     *
+     * @param now Monotonic tick counter (any unit; wraps safely)
+     */
+    EngineResult<T> tick(ComponentId id, const ComponentInput<T>& in, std::uint32_t now) {
+        if (id >= count_) return {MitigationAction::NONE, num<T>(0.0), num<T>(0.0), false};
+        Slot& slot = slots_[id];
+
+        const BasicThresholds<T>& t = scoring_.thresholds();
+        BasicDecision<T> brake = BasicIDIBrake<T>::apply(in.idi, t);
+
+        T hw = scoring_.hardwareCapacity(in.telemetry);
+        T sw = scoring_.softwareDemand(in.telemetry);
+        T imbalance = slot.window.push(scoring_.imbalance(hw, sw));
+        BasicDecision<T> balance = scoring_.decide(imbalance, slot.throttle_level);
+        MitigationAction action = moreSevere(brake.action, balance.action);
+
+        bool quarantined = false;
+#if !defined(SYNAPSE_EMBEDDED_NO_PRUNING)
+        using Pruning = BasicNeuralPruning<T>;
+        if (!slot.quarantined) {
+            if (Pruning::shouldPrune(in.idi, in.telemetry.error_rate, in.health_score,
+                                     in.telemetry.has_temperature, in.telemetry.temperature, t)) {
+                slot.quarantined = true;
+                slot.quarantined_at = now;
+            }
+        } else if (Pruning::canRestore(in.idi, in.health_score, slot.quarantined_at, now,
+                                       min_quarantine_ticks_, t)) {
+            slot.quarantined = false;
+        }
+        quarantined = slot.quarantined;
+        if (quarantined) action = MitigationAction::QUARANTINE;
+#else
+        (void)now;
+#endif
+
+        // CombinedThrottleCalculator: the more restrictive throttle wins
+        slot.throttle_level = quarantined ? num<T>(0.0)
+                                          : fixed::minOf(brake.throttle_level, balance.throttle_level);
+        return {action, slot.throttle_level, imbalance, quarantined};
+    }
+
+#if !defined(SYNAPSE_EMBEDDED_NO_PID)
+    /**
+     * Adaptive throttle adjustment (-0.3 to +0.3) from the component's PID
+     */
+    T pidAdjust(ComponentId id, T utilization) {
+        if (id >= count_) return num<T>(0.0);
+        return slots_[id].pid.calculate(utilization);
+    }
+#endif
+
+    T throttleLevel(ComponentId id) const {
+        return id < count_ ? slots_[id].throttle_level : num<T>(0.0);
+    }
+
+#if !defined(SYNAPSE_EMBEDDED_NO_PRUNING)
+    bool isQuarantined(ComponentId id) const {
+        return id < count_ && slots_[id].quarantined;
+    }
+#endif
+};
+
+} // namespace embedded
+} // namespace neural
+} // namespace synapse
+
+#endif // SYNAPSE_EMBEDDED_BALANCER_HPP
@@ -0,0 +1,494 @@
+/**
+ * SYNAPSE Neural Connection Layer - WebSocket Event Payloads
+ * ==========================================================
+ *
+ * Streaming JSON writer for the events:: payloads, the C++ counterpart of
+ * create_websocket_payload() in neural_mitigation.py:
+ *
+ *   {"event":"mitigation:triggered","timestamp":"...","data":{...}}
+ *
+ * Everything is written through raw pointers into one reusable
+ * JsonBuffer: clear() keeps its capacity, so once it has grown to the
+ * largest frame, formatting an event allocates nothing. Doubles use
+ * std::to_chars (shortest string that round-trips), timestamps are
+ * converted with integer civil-date arithmetic (no gmtime, no locale).
+ *
+ * Several events can share one WebSocket frame:
+ *
+ *   EventPayloadWriter writer;
+ *   writer.beginBatch();
+ *   for (const auto& r : results) writer.mitigation(events::MITIGATION_TRIGGERED, r);
+ *   writer.endBatch();          // [{...},{...}]
+ *   socket.send(writer.view());
+ *   writer.clear();
+ *
+ * Differences from Python's json.dumps: non-ASCII is written as UTF-8
+ * instead of \uXXXX, NaN/Infinity become null (valid JSON), and
+ * timestamps are UTC with a 'Z' suffix instead of naive local time.
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#ifndef SYNAPSE_EVENT_PAYLOAD_HPP
+#define SYNAPSE_EVENT_PAYLOAD_HPP
+
+#include "balancing_algorithm.hpp"
+
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace synapse {
+namespace neural {
+
+// =============================================================================
+// JSON BUFFER
+// =============================================================================
+
+/**
+ * Growable output buffer written through raw pointers
+ *
+ * Writers reserve the worst case with ensure(), write into the returned
+ * pointer and commit() the end; no zero-filling, no per-byte capacity
+ * check. clear() keeps the allocation.
+ */
+class JsonBuffer {
+private:
+    std::unique_ptr<char[]> data_;
+    std::size_t size_ = 0;
+    std::size_t capacity_ = 0;
+
+    void grow(std::size_t needed) {
+        std::size_t capacity = capacity_ ? capacity_ * 2 : 256;
+        while (capacity - size_ < needed) capacity *= 2;
+
+        std::unique_ptr<char[]> data(new char[capacity]);
+        if (size_) std::memcpy(data.get(), data_.get(), size_);
+        data_ = std::move(data);
+        capacity_ = capacity;
+    }
+
+public:
+    explicit JsonBuffer(std::size_t reserve = 0) {
+        if (reserve) grow(reserve);
+    }
+
+    /**
+     * Room for at least `n` more bytes; returns the write position
+     */
+    char* ensure(std::size_t n) {
+        if (capacity_ - size_ < n) grow(n);
+        return data_.get() + size_;
+    }
+
+    void commit(char* end) { size_ = static_cast<std::size_t>(end - data_.get()); }
+
+    void append(const char* text, std::size_t n) {
+        char* p = ensure(n);
+        std::memcpy(p, text, n);
+        size_ += n;
+    }
+
+    void append(char c) {
+        *ensure(1) = c;
+        ++size_;
+    }
+
+    std::string_view view() const { return {data_.get(), size_}; }
+    std::size_t size() const { return size_; }
+    std::size_t capacity() const { return capacity_; }
+    void clear() { size_ = 0; }
+};
+
+// =============================================================================
+// JSON WRITER
+// =============================================================================
+
+/**
+ * Append-only JSON writer over a caller-owned JsonBuffer
+ *
+ * Commas are inserted automatically; nesting is tracked in a 64-bit
+ * mask, so documents may be at most 64 levels deep. No validation beyond
+ * that: keys must be written inside objects, values after keys.
+ */
+class JsonWriter {
+private:
+    JsonBuffer& out_;
+    std::uint64_t has_items_ = 0;   // Bit per open level: needs a comma before the next item
+    unsigned depth_ = 0;
+    bool after_key_ = false;
+
+    // Non-zero for bytes that need escaping: the short escape letter, or 'u'
+    static constexpr std::array<char, 256> ESCAPES = [] {
+        std::array<char, 256> table{};
+        for (int c = 0; c < 0x20; ++c) table[c] = 'u';
+        table['"'] = '"';
+        table['\\'] = '\\';
+        table['\n'] = 'n';
+        table['\r'] = 'r';
+        table['\t'] = 't';
+        table['\b'] = 'b';
+        table['\f'] = 'f';
+        return table;
+    }();
+
+    void separator() {
+        if (after_key_) {
+            after_key_ = false;
+            return;
+        }
+        if (depth_ == 0) return;
+        std::uint64_t bit = std::uint64_t(1) << (depth_ - 1);
+        if (has_items_ & bit) out_.append(',');
+        has_items_ |= bit;
+    }
+
+    void open(char bracket) {
+        separator();
+        out_.append(bracket);
+        ++depth_;
+        has_items_ &= ~(std::uint64_t(1) << (depth_ - 1));
+    }
+
+    void close(char bracket) {
+        --depth_;
+        out_.append(bracket);
+    }
+
+    void escaped(std::string_view text) {
+        static constexpr char HEX[] = "0123456789abcdef";
+
+        // Worst case: every byte becomes \u00XX
+        char* p = out_.ensure(text.size() * 6 + 2);
+        *p++ = '"';
+
+        std::size_t i = 0;
+        while (i < text.size() && !ESCAPES[static_cast<unsigned char>(text[i])]) ++i;
+        std::memcpy(p, text.data(), i);
+        p += i;
+
+        for (; i < text.size(); ++i) {
+            auto c = static_cast<unsigned char>(text[i]);
+            char escape = ESCAPES[c];
+            if (!escape) {
+                *p++ = static_cast<char>(c);
+            } else if (escape != 'u') {
+                *p++ = '\\';
+                *p++ = escape;
+            } else {
+                std::memcpy(p, "\\u00", 4);
+                p[4] = HEX[c >> 4];
+                p[5] = HEX[c & 0xF];
+                p += 6;
+            }
+        }
+
+        *p++ = '"';
+        out_.commit(p);
+    }
+
+    static char* digits(char* p, std::uint32_t v, int width) {
+        for (int i = width - 1; i >= 0; --i) {
+            p[i] = static_cast<char>('0' + v % 10);
+            v /= 10;
+        }
+        return p + width;
+    }
+
+public:
+    explicit JsonWriter(JsonBuffer& out) : out_(out) {}
+
+    JsonWriter& beginObject() { open('{'); return *this; }
+    JsonWriter& endObject() { close('}'); return *this; }
+    JsonWriter& beginArray() { open('['); return *this; }
+    JsonWriter& endArray() { close(']'); return *this; }
+
+    /**
+     * Object key, written verbatim: must not need escaping (identifiers)
+     */
+    JsonWriter& key(std::string_view name) {
+        separator();
+        char* p = out_.ensure(name.size() + 3);
+        *p++ = '"';
+        std::memcpy(p, name.data(), name.size());
+        p += name.size();
+        *p++ = '"';
+        *p++ = ':';
+        out_.commit(p);
+        after_key_ = true;
+        return *this;
+    }
+
+    JsonWriter& value(std::string_view text) {
+        separator();
+        escaped(text);
+        return *this;
+    }
+
+    JsonWriter& value(const char* text) { return value(std::string_view(text)); }
+    JsonWriter& value(const std::string& text) { return value(std::string_view(text)); }
+
+    /**
+     * Shortest round-trip form; integral values keep a ".0" like Python
+     */
+    JsonWriter& value(double number) {
+        separator();
+        if (!std::isfinite(number)) {
+            out_.append("null", 4);
+            return *this;
+        }
+
+        // Shortest double is at most 24 characters, plus ".0"
+        char* begin = out_.ensure(32);
+        char* end = std::to_chars(begin, begin + 30, number).ptr;
+
+        bool integral_form = true;
+        for (const char* p = begin; p != end; ++p) {
+            if (*p == '.' || *p == 'e') {
+                integral_form = false;
+                break;
+            }
+        }
+        if (integral_form) {
+            *end++ = '.';
+            *end++ = '0';
+        }
+        out_.commit(end);
+        return *this;
+    }
+
+    JsonWriter& value(std::int64_t number) {
+        separator();
+        char* begin = out_.ensure(24);
+        out_.commit(std::to_chars(begin, begin + 24, number).ptr);
+        return *this;
+    }
+
+    JsonWriter& value(int number) { return value(static_cast<std::int64_t>(number)); }
+
+    JsonWriter& value(bool flag) {
+        separator();
+        if (flag) {
+            out_.append("true", 4);
+        } else {
+            out_.append("false", 5);
+        }
+        return *this;
+    }
+
+    JsonWriter& null() {
+        separator();
+        out_.append("null", 4);
+        return *this;
+    }
+
+    /**
+     * ISO-8601 UTC with microseconds: 2024-05-01T12:34:56.123456Z
+     *
+     * Years outside 0000-9999 are written as null.
+     */
+    JsonWriter& value(std::chrono::system_clock::time_point time) {
+        constexpr std::int64_t US_PER_DAY = 86400000000LL;
+
+        std::int64_t us = std::chrono::duration_cast<std::chrono::microseconds>(
+            time.time_since_epoch()).count();
+        std::int64_t days = us >= 0 ? us / US_PER_DAY : (us - (US_PER_DAY - 1)) / US_PER_DAY;
+        std::int64_t us_of_day = us - days * US_PER_DAY;
+
+        // civil_from_days (H. Hinnant), proleptic Gregorian
+        std::int64_t z = days + 719468;
+        std::int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+        std::int64_t doe = z - era * 146097;
+        std::int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        std::int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+        std::int64_t mp = (5 * doy + 2) / 153;
+        auto day = static_cast<std::uint32_t>(doy - (153 * mp + 2) / 5 + 1);
+        auto month = static_cast<std::uint32_t>(mp < 10 ? mp + 3 : mp - 9);
+        std::int64_t year = yoe + era * 400 + (month <= 2);
+
+        if (year < 0 || year > 9999) return null();
+        separator();
+
+        auto seconds = static_cast<std::uint32_t>(us_of_day / 1000000);
+        auto micros = static_cast<std::uint32_t>(us_of_day % 1000000);
+
+        char* p = out_.ensure(29);
+        *p++ = '"';
+        p = digits(p, static_cast<std::uint32_t>(year), 4);
+        *p++ = '-';
+        p = digits(p, month, 2);
+        *p++ = '-';
+        p = digits(p, day, 2);
+        *p++ = 'T';
+        p = digits(p, seconds / 3600, 2);
+        *p++ = ':';
+        p = digits(p, seconds / 60 % 60, 2);
+        *p++ = ':';
+        p = digits(p, seconds % 60, 2);
+        *p++ = '.';
+        p = digits(p, micros, 6);
+        *p++ = 'Z';
+        *p++ = '"';
+        out_.commit(p);
+        return *this;
+    }
+
+    template <typename V>
+    JsonWriter& field(std::string_view name, const V& v) {
+        key(name);
+        return value(v);
+    }
+
+    unsigned depth() const { return depth_; }
+
+    /**
+     * Forget the nesting state (after the buffer was cleared)
+     */
+    void reset() {
+        has_items_ = 0;
+        depth_ = 0;
+        after_key_ = false;
+    }
+};
+
+// =============================================================================
+// EVENT PAYLOADS
+// =============================================================================
+
+/**
+ * Formats events:: payloads into one reusable buffer
+ */
+class EventPayloadWriter {
+private:
+    JsonBuffer buffer_;
+    JsonWriter json_{buffer_};
+    bool batching_ = false;
+
+public:
+    explicit EventPayloadWriter(std::size_t reserve = 4096) : buffer_(reserve) {}
+
+    // Non-copyable: json_ refers to buffer_
+    EventPayloadWriter(const EventPayloadWriter&) = delete;
+    EventPayloadWriter& operator=(const EventPayloadWriter&) = delete;
+
+    /**
+     * Start a JSON array frame; every payload until endBatch() joins it
+     */
+    void beginBatch() {
+        json_.beginArray();
+        batching_ = true;
+    }
+
+    void endBatch() {
+        json_.endArray();
+        batching_ = false;
+    }
+
+    /**
+     * Open a payload: writes event and timestamp and leaves the writer
+     * inside "data" for the caller's fields; finish with end()
+     */
+    JsonWriter& begin(const char* event,
+                      std::chrono::system_clock::time_point timestamp = std::chrono::system_clock::now()) {
+        json_.beginObject()
+             .field("event", event)
+             .field("timestamp", timestamp)
+             .key("data")
+             .beginObject();
+        return json_;
+    }
+
+    void end() {
+        json_.endObject().endObject();
+    }
+
+    // -------------------------------------------------------------------------
+    // Typed payloads
+    // -------------------------------------------------------------------------
+
+    /**
+     * mitigation:triggered, component:quarantined, component:restored
+     */
+    void mitigation(const char* event, const MitigationResult& result) {
+        begin(event, result.timestamp)
+            .field("action", toString(result.action))
+            .field("component_id", result.component_id)
+            .field("reason", result.reason)
+            .key("details").beginObject()
+                .field("idi_score", result.idi_score)
+                .field("throttle_level", result.throttle_level)
+                .field("imbalance", result.imbalance)
+            .endObject();
+        end();
+    }
+
+    /**
+     * telemetry:update
+     */
+    void telemetry(const TelemetryData& t) {
+        JsonWriter& w = begin(events::TELEMETRY_UPDATE, t.timestamp);
+        w.field("component_id", t.component_id)
+         .field("cpu_usage", t.cpu_usage)
+         .field("memory_usage", t.memory_usage)
+         .field("io_latency_ms", t.io_latency_ms)
+         .field("network_latency_ms", t.network_latency_ms)
+         .field("error_rate", t.error_rate)
+         .field("throughput", t.throughput);
+        if (t.temperature) w.field("temperature", *t.temperature);
+        if (t.power_consumption) w.field("power_consumption", *t.power_consumption);
+        end();
+    }
+
+    /**
+     * idi:update
+     */
+    void idi(std::string_view component_id, double idi_score, SeverityLevel severity,
+             std::chrono::system_clock::time_point timestamp = std::chrono::system_clock::now()) {
+        begin(events::IDI_UPDATE, timestamp)
+            .field("component_id", component_id)
+            .field("idi_score", idi_score)
+            .field("severity", toString(severity));
+        end();
+    }
+
+    /**
+     * balance:update
+     */
+    void balance(std::string_view component_id, const BalanceMetrics& metrics) {
+        begin(events::BALANCE_UPDATE, metrics.timestamp)
+            .field("component_id", component_id)
+            .field("hw_capacity", metrics.hw_capacity)
+            .field("sw_demand", metrics.sw_demand)
+            .field("imbalance", metrics.imbalance);
+        end();
+    }
+
+    // -------------------------------------------------------------------------
+    // Buffer
+    // -------------------------------------------------------------------------
+
+    std::string_view view() const { return buffer_.view(); }
+    std::size_t size() const { return buffer_.size(); }
+    bool batching() const { return batching_; }
+
+    /**
+     * Drop the contents, keep the capacity
+     */
+    void clear() {
+        buffer_.clear();
+        json_.reset();
+        batching_ = false;
+    }
+};
+
+} // namespace neural
+} // namespace synapse
+
+#endif // SYNAPSE_EVENT_PAYLOAD_HPP
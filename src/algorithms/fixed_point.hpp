@@ -0,0 +1,512 @@
+/**
+ * SYNAPSE Neural Connection Layer - Fixed-Point Scoring
+ * =====================================================
+ *
+ * Scoring, IDI brake, PID and imbalance logic templated on the number
+ * type, for FPU-less targets (Cortex-M0/M0+) where every double
+ * operation is a soft-float library call.
+ *
+ *   BasicBalancerScoring<double>  - reference; same operation order as
+ *                                   HardwareSoftwareBalancer, bit-identical
+ *   BasicBalancerScoring<Q16_16>  - integer only; no runtime float at all
+ *
+ * Fixed<F> is a saturating signed 32-bit Q(31-F).F number; Q16_16 covers
+ * ±32767 with a resolution of 2^-16 (1.5e-5). Multiplications and
+ * divisions round to nearest, so each one adds at most 2^-17 (7.6e-6).
+ * Constant weights are applied as exact integer ratios (x * 2 / 5, not
+ * x * 0.4) and divisions by a runtime value go through one 64-bit
+ * mulDiv, so no quantized reciprocal ever scales an input.
+ *
+ * Error bound vs. the double version (Q16_16, ε = 2^-17 = 7.6e-6; input
+ * quantization included, target_throughput >= 100, default gains):
+ *
+ *   hardwareCapacity  <= 4ε    = 3.1e-5   (observed 0: sweep inputs are exact)
+ *   softwareDemand    <= 205ε  = 1.6e-3   (observed 1.2e-3; error_rate * 1000
+ *                                          magnifies its own quantization)
+ *   imbalance         <= 3.1ε  = 2.4e-5   (observed 2.0e-5)
+ *   brake throttle    <= 2ε    = 1.5e-5   (observed 1.3e-5)
+ *   IDI               <= ε     = 7.6e-6   (observed 7.6e-6)
+ *   PID adjustment    <= 3ε    = 2.3e-5 per tick, plus ki·n·ε/100 of integral
+ *                      drift after n ticks without an anti-windup clamp
+ *                      (observed 1.3e-5 over the sweep)
+ *
+ * Observed values are what bench/fixed_point_bench reports for its 2M
+ * sample sweep (inputs on a 2^-14 grid, so Q16_16 holds them exactly).
+ * Piecewise outputs (brake, severity, decide) can take the other branch
+ * when an input lies within ε of a threshold: 60 of 2M decide() calls
+ * in that sweep.
+ *
+ * Inputs must fit the format: throughput above 32767 req/s saturates in
+ * Q16_16. Scale it (e.g. to kreq/s together with target_throughput) or
+ * use a format with fewer fraction bits.
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#ifndef SYNAPSE_FIXED_POINT_HPP
+#define SYNAPSE_FIXED_POINT_HPP
+
+#include "balancing_types.hpp"
+
+#include <cstdint>
+
+namespace synapse {
+namespace neural {
+namespace fixed {
+
+// =============================================================================
+// FIXED-POINT NUMBER
+// =============================================================================
+
+/**
+ * Saturating signed Q(31-F).F fixed-point number
+ */
+template <int FracBits>
+class Fixed {
+    static_assert(FracBits > 0 && FracBits < 31, "FracBits must be in [1, 30]");
+
+public:
+    using raw_type = std::int32_t;
+    using wide_type = std::int64_t;
+
+    static constexpr int FRAC_BITS = FracBits;
+    static constexpr raw_type ONE = raw_type(1) << FracBits;
+
+private:
+    raw_type raw_ = 0;
+
+    static constexpr raw_type saturate(wide_type value) {
+        if (value > INT32_MAX) return INT32_MAX;
+        if (value < INT32_MIN) return INT32_MIN;
+        return static_cast<raw_type>(value);
+    }
+
+    /**
+     * Round-to-nearest (ties away from zero) signed 64-bit division
+     */
+    static constexpr wide_type roundedDiv(wide_type num, wide_type den) {
+        wide_type q = num / den;
+        wide_type r = num % den;
+        wide_type abs_r = r < 0 ? -r : r;
+        wide_type abs_den = den < 0 ? -den : den;
+        if (2 * abs_r >= abs_den) q += ((num < 0) != (den < 0)) ? -1 : 1;
+        return q;
+    }
+
+public:
+    constexpr Fixed() = default;
+
+    static constexpr Fixed fromRaw(raw_type raw) {
+        Fixed f;
+        f.raw_ = raw;
+        return f;
+    }
+
+    static constexpr Fixed fromInt(std::int32_t value) {
+        return fromRaw(saturate(static_cast<wide_type>(value) * ONE));
+    }
+
+    /**
+     * Round to nearest; soft-float on FPU-less targets, so keep it to
+     * constants (evaluated at compile time) and input conversion
+     */
+    static constexpr Fixed fromDouble(double value) {
+        double scaled = value * ONE;
+        if (scaled >= 2147483647.0) return fromRaw(INT32_MAX);
+        if (scaled <= -2147483648.0) return fromRaw(INT32_MIN);
+        return fromRaw(static_cast<raw_type>(scaled + (scaled >= 0.0 ? 0.5 : -0.5)));
+    }
+
+    static constexpr Fixed max() { return fromRaw(INT32_MAX); }
+    static constexpr Fixed min() { return fromRaw(INT32_MIN); }
+
+    constexpr raw_type raw() const { return raw_; }
+    constexpr double toDouble() const { return static_cast<double>(raw_) / ONE; }
+
+    // Arithmetic (saturating)
+    constexpr Fixed operator+(Fixed other) const {
+        return fromRaw(saturate(static_cast<wide_type>(raw_) + other.raw_));
+    }
+    constexpr Fixed operator-(Fixed other) const {
+        return fromRaw(saturate(static_cast<wide_type>(raw_) - other.raw_));
+    }
+    constexpr Fixed operator-() const {
+        return fromRaw(saturate(-static_cast<wide_type>(raw_)));
+    }
+    constexpr Fixed operator*(Fixed other) const {
+        wide_type product = static_cast<wide_type>(raw_) * other.raw_;
+        return fromRaw(saturate((product + (wide_type(1) << (FracBits - 1))) >> FracBits));
+    }
+    constexpr Fixed operator/(Fixed other) const {
+        if (other.raw_ == 0) return raw_ < 0 ? min() : max();
+        return fromRaw(saturate(roundedDiv(static_cast<wide_type>(raw_) * ONE, other.raw_)));
+    }
+
+    /**
+     * this / divisor for a small integer divisor (32-bit divide only)
+     */
+    constexpr Fixed divInt(std::int32_t divisor) const {
+        std::int32_t half = divisor / 2;
+        return fromRaw((raw_ >= 0 ? raw_ + half : raw_ - half) / divisor);
+    }
+
+    /**
+     * this * num / den for small integers, rounded once
+     */
+    constexpr Fixed mulRatio(std::int32_t num, std::int32_t den) const {
+        return fromRaw(saturate(roundedDiv(static_cast<wide_type>(raw_) * num, den)));
+    }
+
+    /**
+     * (a * b) / c with a single rounding and a 64-bit intermediate
+     */
+    static constexpr Fixed mulDiv(Fixed a, Fixed b, Fixed c) {
+        if (c.raw_ == 0) return ((a.raw_ < 0) != (b.raw_ < 0)) ? min() : max();
+        return fromRaw(saturate(roundedDiv(static_cast<wide_type>(a.raw_) * b.raw_, c.raw_)));
+    }
+
+    constexpr Fixed& operator+=(Fixed other) { return *this = *this + other; }
+    constexpr Fixed& operator-=(Fixed other) { return *this = *this - other; }
+
+    // Comparison
+    constexpr bool operator==(Fixed other) const { return raw_ == other.raw_; }
+    constexpr bool operator!=(Fixed other) const { return raw_ != other.raw_; }
+    constexpr bool operator<(Fixed other) const { return raw_ < other.raw_; }
+    constexpr bool operator<=(Fixed other) const { return raw_ <= other.raw_; }
+    constexpr bool operator>(Fixed other) const { return raw_ > other.raw_; }
+    constexpr bool operator>=(Fixed other) const { return raw_ >= other.raw_; }
+};
+
+using Q16_16 = Fixed<16>;
+
+// =============================================================================
+// NUMBER TRAITS
+// =============================================================================
+
+/**
+ * Operations whose best implementation differs between double and Fixed
+ *
+ * The double versions keep the exact expression order of
+ * balancing_algorithm.hpp so BasicXxx<double> reproduces it bit for bit.
+ */
+template <typename T>
+struct Num;
+
+template <>
+struct Num<double> {
+    static constexpr double from(double value) { return value; }
+    static constexpr double toDouble(double value) { return value; }
+
+    // x * (num / den), the ratio folded to one constant
+    static constexpr double weight(double x, int num, int den) {
+        return x * (static_cast<double>(num) / den);
+    }
+    static constexpr double divInt(double x, int divisor) { return x / divisor; }
+    // (a / c) * b, as written in the double code
+    static constexpr double mulDiv(double a, double b, double c) { return (a / c) * b; }
+};
+
+template <int F>
+struct Num<Fixed<F>> {
+    using T = Fixed<F>;
+
+    static constexpr T from(double value) { return T::fromDouble(value); }
+    static constexpr double toDouble(T value) { return value.toDouble(); }
+
+    static constexpr T weight(T x, int num, int den) {
+        return x.mulRatio(num, den);
+    }
+    static constexpr T divInt(T x, int divisor) { return x.divInt(divisor); }
+    static constexpr T mulDiv(T a, T b, T c) { return T::mulDiv(a, b, c); }
+};
+
+template <typename T>
+constexpr T num(double value) { return Num<T>::from(value); }
+
+template <typename T>
+constexpr T minOf(T a, T b) { return b < a ? b : a; }
+
+template <typename T>
+constexpr T maxOf(T a, T b) { return a < b ? b : a; }
+
+template <typename T>
+constexpr T absOf(T a) { return a < num<T>(0.0) ? -a : a; }
+
+template <typename T>
+constexpr T clampOf(T v, T lo, T hi) { return v < lo ? lo : (hi < v ? hi : v); }
+
+// =============================================================================
+// THRESHOLDS & TELEMETRY
+// =============================================================================
+
+/**
+ * Thresholds converted to T once (at compile time for the defaults)
+ */
+template <typename T>
+struct BasicThresholds {
+    T idi_healthy, idi_warning, idi_critical, idi_quarantine;
+    T temperature_warning, temperature_critical, temperature_shutdown;
+    T hw_sw_imbalance_threshold;
+    T latency_warning_ms, latency_critical_ms;
+
+    constexpr explicit BasicThresholds(const RuntimeThresholds& t = DEFAULT_THRESHOLDS)
+        : idi_healthy(num<T>(t.idi_healthy)),
+          idi_warning(num<T>(t.idi_warning)),
+          idi_critical(num<T>(t.idi_critical)),
+          idi_quarantine(num<T>(t.idi_quarantine)),
+          temperature_warning(num<T>(t.temperature_warning)),
+          temperature_critical(num<T>(t.temperature_critical)),
+          temperature_shutdown(num<T>(t.temperature_shutdown)),
+          hw_sw_imbalance_threshold(num<T>(t.hw_sw_imbalance_threshold)),
+          latency_warning_ms(num<T>(t.latency_warning_ms)),
+          latency_critical_ms(num<T>(t.latency_critical_ms)) {}
+};
+
+template <typename T>
+inline constexpr BasicThresholds<T> DEFAULT_BASIC_THRESHOLDS{DEFAULT_THRESHOLDS};
+
+/**
+ * Telemetry sample without the string id and clock
+ */
+template <typename T>
+struct BasicTelemetry {
+    T cpu_usage{};
+    T memory_usage{};
+    T io_latency_ms{};
+    T network_latency_ms{};
+    T error_rate{};
+    T throughput{};
+    T temperature{};
+    bool has_temperature = false;
+};
+
+template <typename T>
+struct BasicDecision {
+    MitigationAction action;
+    T throttle_level;
+};
+
+// =============================================================================
+// IDI
+// =============================================================================
+
+template <typename T>
+struct BasicIDICalculator;
+
+template <>
+struct BasicIDICalculator<double> {
+    static double calculate(int days, int loc_changed, int dependencies) {
+        double d = days > 0 ? days : 0;
+        double l = (loc_changed > 0 ? loc_changed : 0) / 1000.0;
+        double dep = (dependencies > 1 ? dependencies : 1) / 10.0;
+        return d * l * dep;
+    }
+};
+
+template <int F>
+struct BasicIDICalculator<Fixed<F>> {
+    using T = Fixed<F>;
+
+    /**
+     * days * loc * deps / 10000 in integers, rounded once
+     */
+    static constexpr T calculate(int days, int loc_changed, int dependencies) {
+        std::int64_t d = days > 0 ? days : 0;
+        std::int64_t l = loc_changed > 0 ? loc_changed : 0;
+        std::int64_t dep = dependencies > 1 ? dependencies : 1;
+
+        // Largest days*loc*deps whose IDI still fits the format
+        constexpr std::int64_t LIMIT = (static_cast<std::int64_t>(INT32_MAX) * 10000) >> F;
+        std::int64_t dl = d * l;
+        if (dl > LIMIT / dep) return T::max();
+
+        std::int64_t scaled = (dl * dep) << F;
+        return T::fromRaw(static_cast<std::int32_t>((scaled + 5000) / 10000));
+    }
+};
+
+template <typename T>
+constexpr SeverityLevel severityOf(T idi, const BasicThresholds<T>& t = DEFAULT_BASIC_THRESHOLDS<T>) {
+    if (idi < t.idi_healthy) return SeverityLevel::HEALTHY;
+    if (idi < t.idi_warning) return SeverityLevel::WARNING;
+    if (idi < t.idi_quarantine) return SeverityLevel::CRITICAL;
+    return SeverityLevel::QUARANTINE;
+}
+
+// =============================================================================
+// IDI BRAKE
+// =============================================================================
+
+template <typename T>
+struct BasicIDIBrake {
+    /**
+     * Throttle level 0.0 (stop) - 1.0 (full speed), as IDIBrake
+     */
+    static constexpr T throttleLevel(T idi, const BasicThresholds<T>& t = DEFAULT_BASIC_THRESHOLDS<T>) {
+        using N = Num<T>;
+        if (idi < t.idi_healthy) return num<T>(1.0);
+
+        if (idi < t.idi_warning) {
+            return num<T>(1.0) - N::mulDiv(idi - t.idi_healthy, num<T>(0.3), t.idi_warning - t.idi_healthy);
+        }
+        if (idi < t.idi_critical) {
+            return num<T>(0.7) - N::mulDiv(idi - t.idi_warning, num<T>(0.4), t.idi_critical - t.idi_warning);
+        }
+        if (idi < t.idi_quarantine) {
+            return num<T>(0.3) - N::mulDiv(idi - t.idi_critical, num<T>(0.2), t.idi_quarantine - t.idi_critical);
+        }
+        return num<T>(0.0);
+    }
+
+    static constexpr BasicDecision<T> apply(T idi, const BasicThresholds<T>& t = DEFAULT_BASIC_THRESHOLDS<T>) {
+        T throttle = throttleLevel(idi, t);
+        switch (severityOf(idi, t)) {
+            case SeverityLevel::QUARANTINE: return {MitigationAction::QUARANTINE, num<T>(0.0)};
+            case SeverityLevel::CRITICAL: return {MitigationAction::BRAKE, throttle};
+            case SeverityLevel::WARNING: return {MitigationAction::THROTTLE, throttle};
+            default: return {MitigationAction::NONE, num<T>(1.0)};
+        }
+    }
+};
+
+// =============================================================================
+// PID CONTROLLER
+// =============================================================================
+
+/**
+ * PIDController::calculate over T
+ */
+template <typename T>
+class BasicPIDController {
+private:
+    T kp_, ki_, kd_;
+    T integral_ = num<T>(0.0);
+    T previous_error_ = num<T>(0.0);
+    T target_;
+
+public:
+    constexpr BasicPIDController(T kp = num<T>(0.5), T ki = num<T>(0.1),
+                                 T kd = num<T>(0.05), T target = num<T>(70.0))
+        : kp_(kp), ki_(ki), kd_(kd), target_(target) {}
+
+    void setTarget(T target) { target_ = target; }
+
+    void reset() {
+        integral_ = num<T>(0.0);
+        previous_error_ = num<T>(0.0);
+    }
+
+    /**
+     * @return Adjustment value (-0.3 to +0.3)
+     */
+    T calculate(T current_value) {
+        T error = target_ - current_value;
+        T p_term = kp_ * error;
+
+        integral_ = clampOf(integral_ + error, num<T>(-50.0), num<T>(50.0));
+        T i_term = ki_ * integral_;
+
+        T d_term = kd_ * (error - previous_error_);
+        previous_error_ = error;
+
+        T adjustment = Num<T>::divInt(p_term + i_term + d_term, 100);
+        return clampOf(adjustment, num<T>(-0.3), num<T>(0.3));
+    }
+};
+
+// =============================================================================
+// BALANCER SCORING
+// =============================================================================
+
+/**
+ * Stateless part of HardwareSoftwareBalancer over T
+ *
+ * Smoothing and history stay with the caller (see embedded builds for a
+ * fixed-capacity window).
+ */
+template <typename T>
+class BasicBalancerScoring {
+private:
+    T target_throughput_;
+    BasicThresholds<T> t_;
+
+public:
+    constexpr explicit BasicBalancerScoring(T target_throughput = num<T>(1000.0),
+                                            const BasicThresholds<T>& thresholds = DEFAULT_BASIC_THRESHOLDS<T>)
+        : target_throughput_(target_throughput), t_(thresholds) {}
+
+    const BasicThresholds<T>& thresholds() const { return t_; }
+
+    /**
+     * Hardware capacity score (0-100)
+     */
+    constexpr T hardwareCapacity(const BasicTelemetry<T>& telemetry) const {
+        using N = Num<T>;
+        T cpu_capacity = num<T>(100.0) - telemetry.cpu_usage;
+        T memory_capacity = num<T>(100.0) - telemetry.memory_usage;
+
+        // 100 * temp_factor, exact in every format
+        T temp_term = num<T>(100.0);
+        if (telemetry.has_temperature) {
+            if (telemetry.temperature > t_.temperature_critical) {
+                temp_term = num<T>(30.0);
+            } else if (telemetry.temperature > t_.temperature_warning) {
+                temp_term = num<T>(70.0);
+            }
+        }
+
+        return N::weight(cpu_capacity, 2, 5) + N::weight(memory_capacity, 2, 5) + N::weight(temp_term, 1, 5);
+    }
+
+    /**
+     * Software demand score (0-100)
+     */
+    constexpr T softwareDemand(const BasicTelemetry<T>& telemetry) const {
+        using N = Num<T>;
+        T throughput_demand = minOf(N::mulDiv(telemetry.throughput, num<T>(100.0), target_throughput_),
+                                    num<T>(100.0));
+
+        T latency_urgency;
+        if (telemetry.io_latency_ms > t_.latency_critical_ms) {
+            latency_urgency = num<T>(100.0);
+        } else if (telemetry.io_latency_ms > t_.latency_warning_ms) {
+            latency_urgency = num<T>(70.0);
+        } else {
+            latency_urgency = N::mulDiv(telemetry.io_latency_ms, num<T>(50.0), t_.latency_warning_ms);
+        }
+
+        T error_stress = minOf(telemetry.error_rate * num<T>(1000.0), num<T>(100.0));
+
+        return N::weight(throughput_demand, 1, 2) + N::weight(latency_urgency, 3, 10)
+             + N::weight(error_stress, 1, 5);
+    }
+
+    /**
+     * Imbalance score (-1 to +1)
+     */
+    constexpr T imbalance(T hw_capacity, T sw_demand) const {
+        if (hw_capacity + sw_demand == num<T>(0.0)) return num<T>(0.0);
+        return Num<T>::divInt(hw_capacity - sw_demand, 100);
+    }
+
+    constexpr BasicDecision<T> decide(T imbalance, T current_throttle) const {
+        const T threshold = t_.hw_sw_imbalance_threshold;
+
+        if (absOf(imbalance) < threshold) {
+            return {MitigationAction::NONE, current_throttle};
+        }
+        if (imbalance < -threshold) {
+            T throttle_amount = minOf(absOf(imbalance), num<T>(0.5));
+            return {MitigationAction::THROTTLE, maxOf(current_throttle - throttle_amount, num<T>(0.2))};
+        }
+        T boost_potential = minOf(imbalance, num<T>(0.3));
+        return {MitigationAction::ALERT, minOf(current_throttle + boost_potential, num<T>(1.0))};
+    }
+};
+
+} // namespace fixed
+} // namespace neural
+} // namespace synapse
+
+#endif // SYNAPSE_FIXED_POINT_HPP
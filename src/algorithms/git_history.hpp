@@ -0,0 +1,546 @@
+/**
+ * SYNAPSE Neural Connection Layer - Git History Ingestion
+ * =======================================================
+ *
+ * Computes the IDI inputs of every component from one streamed
+ * `git log --numstat` pass instead of one git invocation per metric and
+ * component:
+ *
+ *   git::ComponentPaths paths;
+ *   paths.add("sensor-driver", "firmware/sensor");
+ *   paths.add("ml-inference", "services/inference");
+ *
+ *   git::HistoryScan scan(paths, std::time(nullptr));
+ *   git::readGitLog(scan, {".", "HEAD"});
+ *   double idi = scan.result(0).idi(graph.dependencyCount(c));
+ *
+ * History is walked newest first along the first-parent chain of the
+ * ref; merge commits are diffed against their first parent, so a merge
+ * touches exactly the files it integrated. For each component:
+ *
+ *   - the integration point is the newest merge that touched it
+ *   - loc_changed sums added + deleted lines of the non-merge commits
+ *     after that point (the unintegrated work)
+ *   - days_since_integration counts from the integration point, or from
+ *     its oldest change when it was never integrated
+ *
+ * Files map to components by path prefix on directory boundaries, the
+ * longest prefix wins; "" matches every file no other prefix claims.
+ *
+ * The tokenizer works on the pipe buffer in place: lines are string_views
+ * into the read chunk, only a line split across two reads is copied, and
+ * prefix lookups hash views without building strings. Reading stops as
+ * soon as every component has found its integration point, so the cost
+ * is bounded by the oldest unintegrated work, not by repository age.
+ *
+ * readGitLog() spawns git on POSIX hosts; elsewhere, or for recorded
+ * logs, feed() the output of
+ *   git log --first-parent -m --numstat --format=%x01%H%x20%ct%x20%P <ref>
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#ifndef SYNAPSE_GIT_HISTORY_HPP
+#define SYNAPSE_GIT_HISTORY_HPP
+
+#include "balancing_algorithm.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <istream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace synapse {
+namespace neural {
+namespace git {
+
+constexpr char COMMIT_MARKER = '\x01';                 // %x01 before every commit header
+constexpr std::int64_t SECONDS_PER_DAY = 86400;
+
+// =============================================================================
+// COMPONENT PATHS
+// =============================================================================
+
+/**
+ * Path prefix -> component index
+ */
+class ComponentPaths {
+private:
+    std::vector<std::string> names_;
+    std::unordered_map<std::string, std::uint32_t> by_name_;
+    std::deque<std::string> prefixes_;                  // Stable storage for the map keys
+    std::unordered_map<std::string_view, std::uint32_t> by_prefix_;
+    std::uint64_t fingerprint_ = 14695981039346656037ULL;    // FNV-1a of every add()
+
+    static std::string_view trim(std::string_view prefix) {
+        while (!prefix.empty() && prefix.back() == '/') prefix.remove_suffix(1);
+        while (prefix.size() >= 2 && prefix[0] == '.' && prefix[1] == '/') prefix.remove_prefix(2);
+        if (prefix == ".") prefix = {};
+        return prefix;
+    }
+
+public:
+    static constexpr std::uint32_t NONE = UINT32_MAX;
+
+    /**
+     * Index of `name`, registering it on first use
+     */
+    std::uint32_t component(const std::string& name) {
+        auto it = by_name_.emplace(name, static_cast<std::uint32_t>(names_.size()));
+        if (it.second) names_.push_back(name);
+        return it.first->second;
+    }
+
+    /**
+     * Map files under `prefix` to `name`; a prefix claimed twice keeps
+     * its first component
+     */
+    std::uint32_t add(const std::string& name, std::string_view prefix) {
+        std::uint32_t index = component(name);
+        prefixes_.emplace_back(trim(prefix));
+        by_prefix_.emplace(std::string_view(prefixes_.back()), index);
+
+        for (std::string_view text : {std::string_view(name), std::string_view(prefixes_.back())}) {
+            for (char ch : text) fingerprint_ = (fingerprint_ ^ static_cast<unsigned char>(ch)) * 1099511628211ULL;
+            fingerprint_ = (fingerprint_ ^ 0xff) * 1099511628211ULL;
+        }
+        return index;
+    }
+
+    size_t size() const { return names_.size(); }
+
+    /**
+     * Identifies the mapping; caches built with another one are stale
+     */
+    std::uint64_t fingerprint() const { return fingerprint_ ^ names_.size(); }
+    const std::string& name(std::uint32_t index) const { return names_[index]; }
+
+    /**
+     * Component owning `path`, or NONE
+     */
+    std::uint32_t match(std::string_view path) const {
+        if (by_prefix_.empty()) return NONE;
+        for (size_t end = path.size();; end = path.rfind('/', end - 1)) {
+            auto it = by_prefix_.find(path.substr(0, end));
+            if (it != by_prefix_.end()) return it->second;
+            if (end == 0 || end == std::string_view::npos) break;
+        }
+        auto root = by_prefix_.find(std::string_view());
+        return root != by_prefix_.end() ? root->second : NONE;
+    }
+};
+
+// =============================================================================
+// RESULTS
+// =============================================================================
+
+struct ComponentHistory {
+    int days_since_integration = 0;
+    std::int64_t loc_changed = 0;          // Added + deleted lines since integration
+    int files_touched = 0;                 // Numstat entries since integration
+    int commits = 0;                       // Non-merge commits since integration
+    bool integrated = false;               // A merge touching it was found
+    std::int64_t last_integration = 0;     // Unix time of that merge, 0 if none
+    std::int64_t oldest_change = 0;        // Unix time of the oldest unintegrated commit
+
+    /**
+     * IDICalculator::calculate() with this component's history
+     */
+    double idi(int dependencies) const {
+        int loc = static_cast<int>(std::min<std::int64_t>(loc_changed, INT_MAX));
+        return IDICalculator::calculate(days_since_integration, loc, dependencies);
+    }
+};
+
+// =============================================================================
+// LOG PARSER
+// =============================================================================
+
+struct CommitHeader {
+    std::string_view sha;
+    std::int64_t time = 0;                 // Committer time, unix seconds
+    std::string_view first_parent;         // Empty for a root commit
+    bool merge = false;
+};
+
+/**
+ * Zero-copy tokenizer for the log format above. Drives a sink with
+ *   bool commit(const CommitHeader&)
+ *   bool file(std::int64_t added, std::int64_t deleted, std::string_view path)
+ * either of which returns false to stop reading. Views are valid for the
+ * duration of the call only.
+ */
+class LogParser {
+private:
+    std::string carry_;                          // Line split across feed() calls
+    std::string rename_;                         // Scratch for "{a => b}" paths
+    bool in_commit_ = false;
+    bool stopped_ = false;
+
+    static bool parseCount(std::string_view field, std::int64_t& value) {
+        value = 0;
+        if (field == "-") return true;                    // Binary file
+        if (field.empty()) return false;
+        for (char ch : field) {
+            if (ch < '0' || ch > '9') return false;
+            value = value * 10 + (ch - '0');
+        }
+        return true;
+    }
+
+    /**
+     * Destination of a numstat rename: "a => b" or "dir/{a => b}/file"
+     */
+    std::string_view renameTarget(std::string_view path) {
+        size_t arrow = path.find(" => ");
+        if (arrow == std::string_view::npos) return path;
+
+        size_t open = path.rfind('{', arrow);
+        size_t close = path.find('}', arrow);
+        if (open == std::string_view::npos || close == std::string_view::npos) {
+            return path.substr(arrow + 4);
+        }
+
+        rename_.assign(path.data(), open);
+        rename_.append(path.data() + arrow + 4, close - arrow - 4);
+        std::string_view tail = path.substr(close + 1);
+        if (rename_.empty() || rename_.back() == '/') {
+            while (!tail.empty() && tail.front() == '/') tail.remove_prefix(1);
+        }
+        rename_.append(tail.data(), tail.size());
+        return rename_;
+    }
+
+    static CommitHeader header(std::string_view line) {
+        // %H %ct %P
+        CommitHeader h;
+        size_t first = line.find(' ');
+        h.sha = line.substr(0, first);
+        if (first == std::string_view::npos) return h;
+
+        size_t second = line.find(' ', first + 1);
+        std::string_view time = line.substr(first + 1, second == std::string_view::npos ? second : second - first - 1);
+        if (!parseCount(time, h.time)) h.time = 0;
+        if (second == std::string_view::npos) return h;
+
+        std::string_view parents = line.substr(second + 1);
+        size_t space = parents.find(' ');
+        h.first_parent = parents.substr(0, space);
+        h.merge = space != std::string_view::npos;
+        return h;
+    }
+
+    template <typename Sink>
+    bool file(std::string_view line, Sink& sink) {
+        size_t tab1 = line.find('\t');
+        if (tab1 == std::string_view::npos) return true;
+        size_t tab2 = line.find('\t', tab1 + 1);
+        if (tab2 == std::string_view::npos) return true;
+
+        std::int64_t added, deleted;
+        if (!parseCount(line.substr(0, tab1), added)) return true;
+        if (!parseCount(line.substr(tab1 + 1, tab2 - tab1 - 1), deleted)) return true;
+
+        std::string_view path = line.substr(tab2 + 1);
+        if (path.size() >= 2 && path.front() == '"' && path.back() == '"') {
+            path = path.substr(1, path.size() - 2);        // Quoted, escapes left as-is
+        }
+        return sink.file(added, deleted, renameTarget(path));
+    }
+
+    template <typename Sink>
+    bool line(std::string_view text, Sink& sink) {
+        if (!text.empty() && text.back() == '\r') text.remove_suffix(1);
+        if (text.empty()) return true;
+        if (text.front() == COMMIT_MARKER) {
+            in_commit_ = true;
+            return sink.commit(header(text.substr(1)));
+        }
+        return in_commit_ ? file(text, sink) : true;
+    }
+
+public:
+    /**
+     * Parse the next chunk of log output; false once the sink stopped
+     */
+    template <typename Sink>
+    bool feed(const char* data, size_t size, Sink& sink) {
+        if (stopped_) return false;
+        const char* end = data + size;
+
+        if (!carry_.empty()) {
+            const char* newline = static_cast<const char*>(std::memchr(data, '\n', size));
+            if (!newline) {
+                carry_.append(data, size);
+                return true;
+            }
+            carry_.append(data, newline);
+            stopped_ = !line(std::string_view(carry_), sink);
+            carry_.clear();
+            data = newline + 1;
+        }
+
+        while (data < end && !stopped_) {
+            const char* newline = static_cast<const char*>(std::memchr(data, '\n', end - data));
+            if (!newline) {
+                carry_.assign(data, end);
+                break;
+            }
+            stopped_ = !line(std::string_view(data, newline - data), sink);
+            data = newline + 1;
+        }
+        return !stopped_;
+    }
+
+    /**
+     * Flush a final line without a trailing newline
+     */
+    template <typename Sink>
+    void finish(Sink& sink) {
+        if (!carry_.empty() && !stopped_) stopped_ = !line(std::string_view(carry_), sink);
+        carry_.clear();
+    }
+};
+
+// =============================================================================
+// HISTORY SCAN
+// =============================================================================
+
+/**
+ * Per-component accumulator for one newest-first walk, fed either by
+ * git log output or by a cached history (see idi_cache.hpp)
+ */
+class HistoryScan {
+private:
+    const ComponentPaths& paths_;
+    std::int64_t now_;
+    LogParser parser_;
+
+    std::vector<ComponentHistory> results_;
+    std::vector<std::uint64_t> last_commit_;     // Commit sequence that last counted a component
+    size_t open_;                                // Components without an integration point
+
+    std::uint64_t commit_seq_ = 0;
+    std::int64_t commit_time_ = 0;
+    bool merge_ = false;
+
+public:
+    HistoryScan(const ComponentPaths& paths, std::int64_t now)
+        : paths_(paths),
+          now_(now),
+          results_(paths.size()),
+          last_commit_(paths.size(), 0),
+          open_(paths.size()) {}
+
+    /**
+     * Parse the next chunk of log output; false once every component is
+     * integrated and the rest of the log is irrelevant
+     */
+    bool feed(const char* data, size_t size) { return parser_.feed(data, size, *this) && !done(); }
+    void finish() { parser_.finish(*this); }
+
+    // LogParser sink
+    bool commit(const CommitHeader& header) {
+        commit(header.time, header.merge);
+        return !done();
+    }
+
+    bool file(std::int64_t added, std::int64_t deleted, std::string_view path) {
+        std::uint32_t c = paths_.match(path);
+        if (c != ComponentPaths::NONE) touch(c, added + deleted, 1);
+        return !done();
+    }
+
+    /**
+     * Start the next older commit
+     */
+    void commit(std::int64_t time, bool merge) {
+        ++commit_seq_;
+        commit_time_ = time;
+        merge_ = merge;
+    }
+
+    /**
+     * The current commit changed `files` files of component c by `loc`
+     * lines
+     */
+    void touch(std::uint32_t c, std::int64_t loc, int files) {
+        ComponentHistory& r = results_[c];
+        if (r.integrated) return;
+
+        if (merge_) {
+            r.integrated = true;
+            r.last_integration = commit_time_;
+            --open_;
+            return;
+        }
+
+        r.loc_changed += loc;
+        r.files_touched += files;
+        r.oldest_change = commit_time_;
+        if (last_commit_[c] != commit_seq_) {
+            last_commit_[c] = commit_seq_;
+            ++r.commits;
+        }
+    }
+
+    bool done() const { return open_ == 0; }
+    std::uint64_t commitsRead() const { return commit_seq_; }
+
+    /**
+     * History of component `index`, with days measured against `now`
+     */
+    ComponentHistory result(std::uint32_t index) const {
+        ComponentHistory r = results_[index];
+        std::int64_t since = r.integrated ? r.last_integration : r.oldest_change;
+        if (since > 0 && now_ > since) {
+            r.days_since_integration = static_cast<int>(
+                    std::min<std::int64_t>((now_ - since) / SECONDS_PER_DAY, INT_MAX));
+        }
+        return r;
+    }
+
+    std::vector<ComponentHistory> results() const {
+        std::vector<ComponentHistory> all;
+        all.reserve(results_.size());
+        for (std::uint32_t c = 0; c < results_.size(); ++c) all.push_back(result(c));
+        return all;
+    }
+};
+
+/**
+ * Feed a recorded log (see the header comment for the format)
+ */
+template <typename Scan>
+void readLog(Scan& scan, std::istream& in) {
+    char buffer[1 << 16];
+    while (in) {
+        in.read(buffer, sizeof(buffer));
+        if (in.gcount() <= 0) break;
+        if (!scan.feed(buffer, static_cast<size_t>(in.gcount()))) return;
+    }
+    scan.finish();
+}
+
+// =============================================================================
+// GIT PROCESS
+// =============================================================================
+
+struct GitLogOptions {
+    std::string repo = ".";
+    std::string ref = "HEAD";
+    std::vector<std::string> exclude;      // Revisions whose history is skipped (^rev)
+};
+
+#if defined(__unix__) || defined(__APPLE__)
+
+/**
+ * Run `git -C repo <args>` and pass its stdout to feed(data, size) until
+ * that returns false, in which case git is killed. Returns git's exit
+ * status, or -1 when stopped early.
+ */
+template <typename Feed>
+int runGit(const std::string& repo, const std::vector<std::string>& args, Feed&& feed) {
+    std::vector<const char*> argv = {"git", "-C", repo.c_str()};
+    for (const std::string& arg : args) argv.push_back(arg.c_str());
+    argv.push_back(nullptr);
+
+    int fds[2];
+    if (pipe(fds) != 0) throw std::runtime_error("git_history: pipe() failed");
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(fds[0]);
+        close(fds[1]);
+        throw std::runtime_error("git_history: fork() failed");
+    }
+
+    if (pid == 0) {
+        dup2(fds[1], STDOUT_FILENO);
+        close(fds[0]);
+        close(fds[1]);
+        execvp("git", const_cast<char* const*>(argv.data()));
+        _exit(127);
+    }
+
+    close(fds[1]);
+    char buffer[1 << 16];
+    bool stopped = false;
+    for (;;) {
+        ssize_t n = read(fds[0], buffer, sizeof(buffer));
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        if (!feed(static_cast<const char*>(buffer), static_cast<size_t>(n))) {
+            stopped = true;
+            break;
+        }
+    }
+    close(fds[0]);                                   // git exits on SIGPIPE if stopped early
+
+    int status = 0;
+    while (waitpid(pid, &status, 0) < 0 && errno == EINTR) {}
+    if (stopped) return -1;
+    return WIFEXITED(status) ? WEXITSTATUS(status) : 128;
+}
+
+/**
+ * Run git log on `options.ref` and stream it into `scan`; git is killed
+ * once the scan is done. Throws std::runtime_error when git cannot be
+ * started or fails.
+ */
+template <typename Scan>
+void readGitLog(Scan& scan, const GitLogOptions& options) {
+    std::string format = "--format=";
+    format += COMMIT_MARKER;
+    format += "%H %ct %P";
+
+    std::vector<std::string> args = {"-c", "core.quotePath=false", "log", "--first-parent", "-m",
+                                     "--numstat", "--no-color", format, options.ref};
+    for (const std::string& rev : options.exclude) args.push_back("^" + rev);
+    args.push_back("--");
+
+    int status = runGit(options.repo, args, [&](const char* data, size_t size) {
+        return scan.feed(data, size);
+    });
+    if (status < 0) return;
+
+    scan.finish();
+    if (status != 0) throw std::runtime_error("git_history: git log failed for " + options.ref);
+}
+
+/**
+ * Full object name of `ref`, or "" when it does not resolve
+ */
+inline std::string revParse(const std::string& repo, const std::string& ref) {
+    std::string out;
+    int status = runGit(repo, {"rev-parse", "--verify", "--quiet", ref + "^{commit}"},
+                        [&](const char* data, size_t size) {
+                            out.append(data, size);
+                            return true;
+                        });
+    while (!out.empty() && (out.back() == '\n' || out.back() == '\r')) out.pop_back();
+    return status == 0 ? out : std::string();
+}
+
+#endif
+
+} // namespace git
+} // namespace neural
+} // namespace synapse
+
+#endif // SYNAPSE_GIT_HISTORY_HPP
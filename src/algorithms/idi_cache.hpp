@@ -0,0 +1,493 @@
+/**
+ * SYNAPSE Neural Connection Layer - Incremental IDI History Cache
+ * ===============================================================
+ *
+ * Persists the per-commit, per-component numbers of git_history.hpp so
+ * that a check only asks git about commits added since the last one:
+ *
+ *   git::HistoryCache cache(".synapse/idi-history.cache", paths);
+ *   cache.update(".", "HEAD");               // git log HEAD ^<cached head>^@
+ *   git::HistoryScan scan(paths, std::time(nullptr));
+ *   cache.replay(scan);
+ *   double idi = scan.result(c).idi(dependencies);
+ *
+ * File layout (native endianness, append-only after the header):
+ *
+ *   CacheHeader                               128 bytes
+ *   per commit, oldest first along the first-parent chain:
+ *     CacheEntry[entries]                     16 bytes each, one per touched component
+ *     CacheTrailer                            48 bytes: sha, time, merge flag, entries
+ *
+ * Trailers sit after their entries so the file reads backwards, newest
+ * first, straight from the mapping; replay() stops as soon as every
+ * component has found its integration point, as a live scan would.
+ *
+ * update() lists `ref ^head^@`, i.e. the new first-parent commits down
+ * to and including the cached head, and stops git when it reaches the
+ * head. When the head is no longer in the ref's history (rebase, reset,
+ * branch switch) the listing ends at the fork point instead: the first
+ * parent of its oldest commit, which is then looked up in the cache and
+ * everything after it dropped. A first-parent chain is immutable, so the
+ * kept part is still exact. Only when the fork point is not cached, or
+ * the cache was built with different component paths, is it rebuilt.
+ *
+ * New entries are only written past the data the on-disk header covers:
+ * when commits are dropped the header is first cut back to the kept
+ * prefix, then the entries are written, the final header published and
+ * the file truncated. A crash of the updating process at any step leaves
+ * a valid cache (nothing is fsynced, so this does not cover power loss).
+ * Updates take an exclusive flock, replays a shared one.
+ *
+ * POSIX only.
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#ifndef SYNAPSE_IDI_CACHE_HPP
+#define SYNAPSE_IDI_CACHE_HPP
+
+#include "git_history.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace synapse {
+namespace neural {
+namespace git {
+
+constexpr char CACHE_MAGIC[8] = {'S', 'Y', 'N', 'I', 'D', 'I', 'C', '1'};
+constexpr std::uint32_t CACHE_VERSION = 1;
+
+struct CacheHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t components;
+    std::uint64_t fingerprint;             // ComponentPaths::fingerprint()
+    std::uint64_t commits;
+    std::uint64_t data_end;                // Bytes of valid records, header included
+    char head[72];                         // Hex object name of the newest commit
+    std::uint8_t reserved[16];
+};
+
+struct CacheEntry {
+    std::uint32_t component;
+    std::uint32_t files;
+    std::int64_t loc;
+};
+
+struct CacheTrailer {
+    std::uint8_t sha[32];                  // SHA-1 or SHA-256, zero padded
+    std::uint32_t entries;
+    std::uint32_t flags;
+    std::int64_t time;
+};
+
+static_assert(sizeof(CacheHeader) == 128, "CacheHeader layout");
+static_assert(sizeof(CacheEntry) == 16, "CacheEntry layout");
+static_assert(sizeof(CacheTrailer) == 48, "CacheTrailer layout");
+
+constexpr std::uint32_t CACHE_MERGE = 1;
+
+/**
+ * What update() did
+ */
+struct CacheUpdate {
+    std::uint64_t appended = 0;            // New commits parsed from git
+    std::uint64_t dropped = 0;             // Cached commits no longer in the ref's history
+    bool rebuilt = false;                  // Cache was stale or the fork point unknown
+};
+
+// =============================================================================
+// COMMIT COLLECTOR
+// =============================================================================
+
+/**
+ * LogParser sink that aggregates numstat lines per commit and component,
+ * stopping at `stop_at`
+ */
+class CommitCollector {
+public:
+    struct Commit {
+        CacheTrailer trailer{};
+        std::string sha;
+        std::string first_parent;
+        std::vector<CacheEntry> entries;
+    };
+
+private:
+    const ComponentPaths& paths_;
+    std::string stop_at_;
+    LogParser parser_;
+    std::vector<Commit> commits_;                 // Newest first
+    std::vector<std::int32_t> slot_;              // Component -> entry of the current commit
+    bool reached_ = false;
+
+    void closeCommit() {
+        if (commits_.empty()) return;
+        Commit& last = commits_.back();
+        for (const CacheEntry& e : last.entries) slot_[e.component] = -1;
+        last.trailer.entries = static_cast<std::uint32_t>(last.entries.size());
+    }
+
+public:
+    CommitCollector(const ComponentPaths& paths, std::string stop_at)
+        : paths_(paths), stop_at_(std::move(stop_at)), slot_(paths.size(), -1) {}
+
+    bool feed(const char* data, size_t size) { return parser_.feed(data, size, *this); }
+
+    void finish() {
+        parser_.finish(*this);
+        closeCommit();
+    }
+
+    bool commit(const CommitHeader& header) {
+        closeCommit();
+        if (!stop_at_.empty() && header.sha == stop_at_) {
+            reached_ = true;
+            return false;
+        }
+
+        commits_.emplace_back();
+        Commit& c = commits_.back();
+        c.sha.assign(header.sha.data(), header.sha.size());
+        c.first_parent.assign(header.first_parent.data(), header.first_parent.size());
+        c.trailer.time = header.time;
+        c.trailer.flags = header.merge ? CACHE_MERGE : 0;
+        encodeSha(header.sha, c.trailer.sha);
+        return true;
+    }
+
+    bool file(std::int64_t added, std::int64_t deleted, std::string_view path) {
+        std::uint32_t component = paths_.match(path);
+        if (component == ComponentPaths::NONE || commits_.empty()) return true;
+
+        std::vector<CacheEntry>& entries = commits_.back().entries;
+        std::int32_t& slot = slot_[component];
+        if (slot < 0) {
+            slot = static_cast<std::int32_t>(entries.size());
+            entries.push_back({component, 0, 0});
+        }
+        entries[slot].files += 1;
+        entries[slot].loc += added + deleted;
+        return true;
+    }
+
+    bool reached() const { return reached_; }
+    const std::vector<Commit>& commits() const { return commits_; }
+
+    static void encodeSha(std::string_view hex, std::uint8_t (&out)[32]) {
+        std::memset(out, 0, sizeof(out));
+        auto nibble = [](char ch) -> std::uint8_t {
+            if (ch >= '0' && ch <= '9') return static_cast<std::uint8_t>(ch - '0');
+            if (ch >= 'a' && ch <= 'f') return static_cast<std::uint8_t>(ch - 'a' + 10);
+            if (ch >= 'A' && ch <= 'F') return static_cast<std::uint8_t>(ch - 'A' + 10);
+            return 0;
+        };
+        for (size_t i = 0; i + 1 < hex.size() && i / 2 < sizeof(out); i += 2) {
+            out[i / 2] = static_cast<std::uint8_t>(nibble(hex[i]) << 4 | nibble(hex[i + 1]));
+        }
+    }
+};
+
+// =============================================================================
+// HISTORY CACHE
+// =============================================================================
+
+class HistoryCache {
+private:
+    const ComponentPaths& paths_;
+    std::string path_;
+    int fd_ = -1;
+    const std::uint8_t* map_ = nullptr;
+    size_t map_size_ = 0;
+    CacheHeader header_{};
+
+    /**
+     * RAII flock
+     */
+    class Lock {
+    private:
+        int fd_;
+    public:
+        Lock(int fd, int operation) : fd_(fd) {
+            while (flock(fd_, operation) != 0) {
+                if (errno != EINTR) throw std::runtime_error("idi_cache: flock() failed");
+            }
+        }
+        ~Lock() { flock(fd_, LOCK_UN); }
+        Lock(const Lock&) = delete;
+        Lock& operator=(const Lock&) = delete;
+    };
+
+    void unmap() {
+        if (map_) munmap(const_cast<std::uint8_t*>(map_), map_size_);
+        map_ = nullptr;
+        map_size_ = 0;
+    }
+
+    /**
+     * Map the file and load its header; a missing, foreign or stale
+     * cache reads as empty
+     */
+    void remap() {
+        unmap();
+        struct stat st;
+        if (fstat(fd_, &st) == 0 && st.st_size >= static_cast<off_t>(sizeof(CacheHeader))) {
+            void* p = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd_, 0);
+            if (p != MAP_FAILED) {
+                map_ = static_cast<const std::uint8_t*>(p);
+                map_size_ = static_cast<size_t>(st.st_size);
+            }
+        }
+
+        if (map_) std::memcpy(&header_, map_, sizeof(header_));
+        bool valid = map_
+                && std::memcmp(header_.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) == 0
+                && header_.version == CACHE_VERSION
+                && header_.components == paths_.size()
+                && header_.fingerprint == paths_.fingerprint()
+                && header_.data_end >= sizeof(CacheHeader)
+                && header_.data_end <= map_size_
+                && header_.head[sizeof(header_.head) - 1] == '\0';
+        if (!valid) reset(header_);
+    }
+
+    void reset(CacheHeader& header) const {
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+        header.version = CACHE_VERSION;
+        header.components = static_cast<std::uint32_t>(paths_.size());
+        header.fingerprint = paths_.fingerprint();
+        header.data_end = sizeof(CacheHeader);
+    }
+
+    /**
+     * fn(trailer, entries) newest first until it returns false
+     */
+    template <typename Fn>
+    void walk(Fn&& fn) const {
+        std::uint64_t offset = header_.data_end;
+        while (offset >= sizeof(CacheHeader) + sizeof(CacheTrailer)) {
+            CacheTrailer trailer;
+            std::memcpy(&trailer, map_ + offset - sizeof(CacheTrailer), sizeof(trailer));
+            std::uint64_t entry_bytes = std::uint64_t(trailer.entries) * sizeof(CacheEntry);
+            if (offset - sizeof(CacheTrailer) - sizeof(CacheHeader) < entry_bytes) break;   // Corrupt
+
+            offset -= sizeof(CacheTrailer) + entry_bytes;
+            if (!fn(trailer, reinterpret_cast<const CacheEntry*>(map_ + offset), offset)) break;
+        }
+    }
+
+    /**
+     * End offset of `sha`'s record and the number of commits after it;
+     * 0 when it is not cached
+     */
+    std::uint64_t findCommit(const std::string& sha, std::uint64_t& newer) const {
+        std::uint8_t key[32];
+        CommitCollector::encodeSha(sha, key);
+
+        std::uint64_t found = 0, seen = 0, end = header_.data_end;
+        walk([&](const CacheTrailer& trailer, const CacheEntry*, std::uint64_t start) {
+            if (std::memcmp(trailer.sha, key, sizeof(key)) == 0) {
+                found = end;
+                newer = seen;
+                return false;
+            }
+            ++seen;
+            end = start;
+            return true;
+        });
+        return found;
+    }
+
+    void collect(CommitCollector& collector, const std::string& repo, const std::string& ref,
+                 std::vector<std::string> exclude) {
+        readGitLog(collector, {repo, ref, std::move(exclude)});
+    }
+
+    static void setHead(CacheHeader& header, const std::string& head) {
+        std::memset(header.head, 0, sizeof(header.head));
+        std::memcpy(header.head, head.data(), std::min(head.size(), sizeof(header.head) - 1));
+    }
+
+    /**
+     * Keep [0, keep) (`kept_commits` commits up to `kept_head`) and
+     * append the collected commits, ending at `head`
+     */
+    void write(std::uint64_t keep, std::uint64_t kept_commits, const std::string& kept_head,
+               const CommitCollector& collector, const std::string& head) {
+        std::vector<std::uint8_t> buffer;
+        const auto& commits = collector.commits();
+        for (auto it = commits.rbegin(); it != commits.rend(); ++it) {
+            const std::uint8_t* entries = reinterpret_cast<const std::uint8_t*>(it->entries.data());
+            buffer.insert(buffer.end(), entries, entries + it->entries.size() * sizeof(CacheEntry));
+            const std::uint8_t* trailer = reinterpret_cast<const std::uint8_t*>(&it->trailer);
+            buffer.insert(buffer.end(), trailer, trailer + sizeof(CacheTrailer));
+        }
+
+        CacheHeader header = header_;
+        header.data_end = keep;
+        header.commits = kept_commits;
+        setHead(header, kept_head);
+
+        // The on-disk header may cover bytes past `keep`: cut it back to
+        // the kept prefix before overwriting them
+        const bool overwrites = !buffer.empty() && keep < map_size_;
+
+        unmap();
+        bool ok = !overwrites || writeAll(reinterpret_cast<const std::uint8_t*>(&header), sizeof(header), 0);
+        header.data_end = keep + buffer.size();
+        header.commits = kept_commits + commits.size();
+        setHead(header, head);
+        ok = ok
+            && writeAll(buffer.data(), buffer.size(), keep)
+            && writeAll(reinterpret_cast<const std::uint8_t*>(&header), sizeof(header), 0)
+            && ftruncate(fd_, static_cast<off_t>(header.data_end)) == 0;
+        remap();
+        if (!ok) throw std::runtime_error("idi_cache: cannot write " + path_);
+    }
+
+    bool writeAll(const std::uint8_t* data, size_t size, std::uint64_t offset) {
+        while (size > 0) {
+            ssize_t n = pwrite(fd_, data, size, static_cast<off_t>(offset));
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) return false;
+            data += n;
+            size -= static_cast<size_t>(n);
+            offset += static_cast<std::uint64_t>(n);
+        }
+        return true;
+    }
+
+public:
+    /**
+     * Open or create the cache at `path` for this component mapping.
+     * Throws std::runtime_error when the file cannot be opened.
+     */
+    HistoryCache(const std::string& path, const ComponentPaths& paths)
+        : paths_(paths), path_(path) {
+        fd_ = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (fd_ < 0) throw std::runtime_error("idi_cache: cannot open " + path);
+        Lock lock(fd_, LOCK_SH);
+        remap();
+    }
+
+    ~HistoryCache() {
+        unmap();
+        if (fd_ >= 0) close(fd_);
+    }
+
+    HistoryCache(const HistoryCache&) = delete;
+    HistoryCache& operator=(const HistoryCache&) = delete;
+
+    /**
+     * Bring the cache up to date with `ref`. Throws std::runtime_error
+     * when git fails on the ref itself.
+     */
+    CacheUpdate update(const std::string& repo, const std::string& ref = "HEAD") {
+        Lock lock(fd_, LOCK_EX);
+        remap();                                         // Another process may have updated it
+
+        CacheUpdate result;
+        const std::string head = header_.head;
+        std::string kept_head = head;
+        std::uint64_t keep = 0, dropped = 0;
+
+        CommitCollector collector(paths_, head);
+        bool listed = false;
+        if (!head.empty()) {
+            try {
+                collect(collector, repo, ref, {head + "^@"});
+                listed = true;
+            } catch (const std::runtime_error&) {
+                // Cached head no longer exists (gc after a rebase): rebuild below
+            }
+        }
+
+        if (listed) {
+            if (collector.reached()) {
+                keep = header_.data_end;
+            } else if (!collector.commits().empty()) {
+                const std::string& fork = collector.commits().back().first_parent;
+                keep = fork.empty() ? sizeof(CacheHeader) : findCommit(fork, dropped);
+                if (fork.empty()) dropped = header_.commits;
+                kept_head = fork;
+            } else {
+                // ref moved back inside the cached history
+                std::string tip = revParse(repo, ref);
+                if (tip.empty()) throw std::runtime_error("idi_cache: unknown revision " + ref);
+                keep = findCommit(tip, dropped);
+                if (keep) {
+                    write(keep, header_.commits - dropped, tip, collector, tip);
+                    result.dropped = dropped;
+                    return result;
+                }
+            }
+        }
+
+        if (keep == 0) {
+            CommitCollector full(paths_, std::string());
+            collect(full, repo, ref, {});
+            reset(header_);
+            result.rebuilt = true;
+            result.appended = full.commits().size();
+            write(sizeof(CacheHeader), 0, std::string(), full,
+                  full.commits().empty() ? std::string() : full.commits().front().sha);
+            return result;
+        }
+
+        result.appended = collector.commits().size();
+        result.dropped = dropped;
+        if (result.appended == 0 && dropped == 0) return result;    // Already current
+
+        write(keep, header_.commits - dropped, kept_head, collector,
+              collector.commits().empty() ? kept_head : collector.commits().front().sha);
+        return result;
+    }
+
+    /**
+     * Feed the cached history into `scan`, newest first, until every
+     * component is integrated
+     */
+    void replay(HistoryScan& scan) {
+        Lock lock(fd_, LOCK_SH);
+        remap();
+        walk([&](const CacheTrailer& trailer, const CacheEntry* entries, std::uint64_t) {
+            scan.commit(trailer.time, (trailer.flags & CACHE_MERGE) != 0);
+            for (std::uint32_t i = 0; i < trailer.entries; ++i) {
+                CacheEntry e;
+                std::memcpy(&e, entries + i, sizeof(e));
+                if (e.component < paths_.size()) {
+                    scan.touch(e.component, e.loc, static_cast<int>(e.files));
+                }
+            }
+            return !scan.done();
+        });
+    }
+
+    std::uint64_t commitCount() const { return header_.commits; }
+    std::string head() const { return header_.head; }
+};
+
+} // namespace git
+} // namespace neural
+} // namespace synapse
+
+#endif
+
+#endif // SYNAPSE_IDI_CACHE_HPP
@@ -25,6 +25,7 @@ Exit Codes:
 import re
 import sys
 import json
+import hashlib
 import argparse
 import subprocess
 from dataclasses import dataclass, field
@@ -33,6 +34,12 @@ from typing import List, Dict, Optional, Tuple
 from enum import Enum
 from pathlib import Path
 
+# Opsiyonel C++ motoru (python setup.py build_ext --inplace); yoksa saf Python
+try:
+    import _synapse_native as _native
+except ImportError:
+    _native = None
+
 
 # =============================================================================
 # CONFIGURATION
@@ -155,6 +162,12 @@ class IDICalculator:
         """
         IDI = (Days Since Last Integration) × (LoC Changed / 1000) × (Dependencies / 10)
         """
+        if _native is not None:
+            try:
+                return round(_native.idi_calculate(days, loc_changed, dependencies), 2)
+            except (OverflowError, TypeError):
+                pass
+
         d = max(days, 0)
         l = max(loc_changed, 0) / 1000.0
         dep = max(dependencies, 1) / 10.0
@@ -220,7 +233,35 @@ class CommitAnalyzer:
 
         return False, commit_type
 
-    def analyze_commit(self, message: str, lock_level: LockLevel) -> LockDecision:
+    def classify_batch(self, messages: List[str]) -> List[Tuple[bool, str]]:
+        """
+        is_allowed_commit() toplu hali
+
+        C++ motoru varsa mesajlar tek geçişte derlenmiş DFA ile sınıflanır;
+        Unicode'a bağlı (None dönen) mesajlar Python yolundan geçer.
+        """
+        results = None
+        if _native is not None and hasattr(_native, 'classify_commits'):
+            try:
+                results = _native.classify_commits(messages, self.allowed_types)
+            except (ValueError, TypeError, UnicodeError):
+                results = None
+
+        if results is None:
+            return [self.is_allowed_commit(m) for m in messages]
+
+        return [r if r is not None else self.is_allowed_commit(m) for m, r in zip(messages, results)]
+
+    def analyze_batch(self, messages: List[str], lock_level: LockLevel) -> List[LockDecision]:
+        """analyze_commit() toplu hali (geçmiş commit'ler için backfill)"""
+        if lock_level in (LockLevel.NONE, LockLevel.TOTAL):
+            return [self.analyze_commit(m, lock_level) for m in messages]
+
+        classified = self.classify_batch(messages)
+        return [self.analyze_commit(m, lock_level, c) for m, c in zip(messages, classified)]
+
+    def analyze_commit(self, message: str, lock_level: LockLevel,
+                       classification: Optional[Tuple[bool, str]] = None) -> LockDecision:
         """Commit'i analiz et ve karar ver"""
 
         if lock_level == LockLevel.NONE:
@@ -246,7 +287,7 @@ class CommitAnalyzer:
                 ]
             )
 
-        is_allowed, commit_type = self.is_allowed_commit(message)
+        is_allowed, commit_type = classification or self.is_allowed_commit(message)
 
         if lock_level == LockLevel.HARD:
             if is_allowed:
@@ -363,6 +404,27 @@ class GitIntegration:
         except subprocess.CalledProcessError:
             return 0
 
+    @staticmethod
+    def get_component_history(paths: Dict[str, List[str]], ref: str = "HEAD",
+                              cache: Optional[str] = None) -> Optional[Dict[str, Dict]]:
+        """
+        Tüm bileşenlerin IDI girdileri tek bir git log geçişinde (C++ motoru)
+
+        paths: bileşen -> path prefix listesi. cache verilirse yalnızca son
+        kontrolden sonra eklenen commit'ler işlenir (rebase'e dayanıklı).
+        Motor yoksa veya git başarısızsa None döner; çağıran tekil
+        metriklere geri düşer.
+        """
+        if _native is None or not hasattr(_native, 'git_component_history'):
+            return None
+        try:
+            if cache:
+                Path(cache).parent.mkdir(parents=True, exist_ok=True)
+                return _native.git_component_history(paths, ref=ref, cache=cache)
+            return _native.git_component_history(paths, ref=ref)
+        except RuntimeError:
+            return None
+
     @staticmethod
     def get_days_since_last_integration(branch: str = "main") -> int:
         """Son entegrasyondan bu yana geçen gün sayısı"""
@@ -393,6 +455,7 @@ class IDILockEngine:
         self.analyzer = CommitAnalyzer()
         self.git = GitIntegration()
         self.config_path = config_path or ".synapse/idi-lock.json"
+        self.history_dir = Path(self.config_path).parent
         self.components: Dict[str, ComponentState] = {}
         self._load_config()
 
@@ -432,12 +495,46 @@ class IDILockEngine:
         with open(config_file, 'w') as f:
             json.dump(data, f, indent=2)
 
+    def update_components(self, paths: Dict[str, List[str]], project_id: str = "default",
+                          dependencies: Optional[Dict[str, int]] = None) -> Dict[str, ComponentState]:
+        """Birden çok bileşeni tek git geçişiyle güncelle (path prefix'lerine göre)"""
+        dependencies = dependencies or {}
+        # Cache dosyası bileşen/path eşlemesine özgü; farklı eşlemeler birbirini geçersiz kılmaz
+        mapping = hashlib.sha1(json.dumps(paths, sort_keys=True).encode()).hexdigest()[:12]
+        cache = str(self.history_dir / f"idi-history-{mapping}.cache")
+        history = self.git.get_component_history(paths, cache=cache)
+
+        if history is None:
+            days = self.git.get_days_since_last_integration()
+            loc = self.git.get_loc_changed()
+            history = {cid: {'days_since_integration': days, 'loc_changed': loc} for cid in paths}
+
+        updated = {}
+        for component_id, h in history.items():
+            updated[component_id] = self._set_component(
+                component_id, project_id, dependencies.get(component_id, 1),
+                h['days_since_integration'], h['loc_changed'])
+
+        self._save_config()
+        return updated
+
     def update_component(self, component_id: str, project_id: str = "default",
-                         dependencies: int = 1) -> ComponentState:
+                         dependencies: int = 1, paths: Optional[List[str]] = None) -> ComponentState:
         """Bileşen IDI'sini güncelle"""
+        if paths:
+            return self.update_components({component_id: paths}, project_id,
+                                          {component_id: dependencies})[component_id]
+
         days = self.git.get_days_since_last_integration()
         loc = self.git.get_loc_changed()
 
+        comp = self._set_component(component_id, project_id, dependencies, days, loc)
+        self._save_config()
+
+        return comp
+
+    def _set_component(self, component_id: str, project_id: str, dependencies: int,
+                       days: int, loc: int) -> ComponentState:
         idi = IDICalculator.calculate(days, loc, dependencies)
         lock_level = IDICalculator.get_lock_level(idi)
 
@@ -454,8 +551,6 @@ class IDILockEngine:
         )
 
         self.components[component_id] = comp
-        self._save_config()
-
         return comp
 
     def check_commit(self, component_id: str, commit_message: Optional[str] = None) -> LockDecision:
@@ -504,7 +599,7 @@ class IDILockEngine:
 # CI/CD INTEGRATION
 # =============================================================================
 
-def ci_check(project_id: str, component_id: str) -> int:
+def ci_check(project_id: str, component_id: str, paths: Optional[List[str]] = None) -> int:
     """
     CI/CD pipeline'da kullanılacak kontrol fonksiyonu
 
@@ -515,7 +610,7 @@ def ci_check(project_id: str, component_id: str) -> int:
     engine = IDILockEngine()
 
     # Bileşeni güncelle
-    comp = engine.update_component(component_id, project_id)
+    comp = engine.update_component(component_id, project_id, paths=paths)
 
     # Commit'i kontrol et
     decision = engine.check_commit(component_id)
@@ -595,6 +690,9 @@ Examples:
   # CI/CD mode
   python idi_lock.py --mode=ci --project=smart-iot --component=ml-inference
 
+  # CI/CD mode, IDI inputs from the component's own history
+  python idi_lock.py --mode=ci --component=ml-inference --paths=services/inference
+
   # Check status
   python idi_lock.py --mode=status --project=smart-iot
 
@@ -607,6 +705,7 @@ Examples:
                         default='check', help='Operation mode')
     parser.add_argument('--project', default='default', help='Project ID')
     parser.add_argument('--component', help='Component ID')
+    parser.add_argument('--paths', help='Comma-separated path prefixes of the component (ci mode)')
     parser.add_argument('--message', help='Commit message (for testing)')
     parser.add_argument('--reason', help='Reason for unlock')
     parser.add_argument('--json', action='store_true', help='Output as JSON')
@@ -623,7 +722,8 @@ Examples:
         if not args.component:
             print("Error: --component required for ci mode", file=sys.stderr)
             sys.exit(2)
-        sys.exit(ci_check(args.project, args.component))
+        paths = [p for p in args.paths.split(',') if p] if args.paths else None
+        sys.exit(ci_check(args.project, args.component, paths))
 
     elif args.mode == 'status':
         engine = IDILockEngine()
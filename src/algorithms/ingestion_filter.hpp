@@ -0,0 +1,166 @@
+/**
+ * SYNAPSE Neural Connection Layer - Deadband Ingestion Filter
+ * ===========================================================
+ *
+ * Optional filter in front of HardwareSoftwareBalancer. Telemetry that
+ * stays inside per-signal deadbands is treated as "still the same" and,
+ * once the balancer has settled, is only counted instead of re-scored.
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#ifndef SYNAPSE_INGESTION_FILTER_HPP
+#define SYNAPSE_INGESTION_FILTER_HPP
+
+#include "balancing_algorithm.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+
+namespace synapse {
+namespace neural {
+
+// =============================================================================
+// DEADBAND CONFIGURATION
+// =============================================================================
+
+/**
+ * Per-signal deadbands (absolute units of each TelemetryData field)
+ *
+ * A sample is "unchanged" when every signal is within its deadband of
+ * the held sample. All zeros = only bit-identical samples coalesce.
+ */
+struct DeadbandConfig {
+    double cpu_usage = 0.5;
+    double memory_usage = 0.5;
+    double io_latency_ms = 1.0;
+    double network_latency_ms = 1.0;
+    double error_rate = 0.0005;
+    double throughput = 5.0;
+    double temperature = 0.5;
+    double power_consumption = 0.5;
+};
+
+// =============================================================================
+// DEADBAND FILTER
+// =============================================================================
+
+/**
+ * Deadband + coalescing filter (one per component / balancer)
+ *
+ * Works as sample-and-hold: while telemetry stays inside the deadbands
+ * the balancer keeps seeing the held sample. After one full moving-average
+ * window of held samples with a NONE decision and an unchanged throttle,
+ * balance() is a fixed point, so further samples only bump a counter.
+ * The first sample that leaves the deadband replays the counted ticks
+ * with repeatLast() and is then balanced normally. The decisions and
+ * the moving average are therefore identical to balancing every held
+ * sample; use PIDController::calculateRepeated() with stillSameTicks()
+ * to advance a PID across the same run.
+ */
+class DeadbandFilter {
+private:
+    HardwareSoftwareBalancer& balancer_;
+    DeadbandConfig config_;
+
+    TelemetryData held_;
+    bool has_held_ = false;
+    size_t held_run_ = 0;
+    std::uint64_t still_same_ = 0;
+    std::uint64_t coalesced_total_ = 0;
+    std::chrono::system_clock::time_point first_same_{};
+    std::chrono::system_clock::time_point last_same_{};
+    MitigationResult last_{};
+
+    static bool within(double a, double b, double band) {
+        return std::abs(a - b) <= band;
+    }
+
+    static bool within(const std::optional<double>& a, const std::optional<double>& b, double band) {
+        if (a.has_value() != b.has_value()) return false;
+        return !a || within(*a, *b, band);
+    }
+
+    bool unchanged(const TelemetryData& t) const {
+        return within(t.cpu_usage, held_.cpu_usage, config_.cpu_usage)
+            && within(t.memory_usage, held_.memory_usage, config_.memory_usage)
+            && within(t.io_latency_ms, held_.io_latency_ms, config_.io_latency_ms)
+            && within(t.network_latency_ms, held_.network_latency_ms, config_.network_latency_ms)
+            && within(t.error_rate, held_.error_rate, config_.error_rate)
+            && within(t.throughput, held_.throughput, config_.throughput)
+            && within(t.temperature, held_.temperature, config_.temperature)
+            && within(t.power_consumption, held_.power_consumption, config_.power_consumption);
+    }
+
+    void flush() {
+        if (still_same_ == 0) return;
+        balancer_.repeatLast(static_cast<size_t>(still_same_), first_same_, last_same_);
+        held_run_ += static_cast<size_t>(still_same_);
+        still_same_ = 0;
+    }
+
+public:
+    explicit DeadbandFilter(HardwareSoftwareBalancer& balancer,
+                            const DeadbandConfig& config = DeadbandConfig{})
+        : balancer_(balancer), config_(config) {}
+
+    /**
+     * Filter one telemetry sample
+     *
+     * @return Same result balance() would give for the held sample
+     */
+    const MitigationResult& process(const TelemetryData& telemetry, double current_throttle) {
+        if (!has_held_ || !unchanged(telemetry)) {
+            flush();
+            held_ = telemetry;
+            has_held_ = true;
+            held_run_ = 1;
+            last_ = balancer_.balance(held_, current_throttle);
+            return last_;
+        }
+
+        const bool settled = held_run_ >= balancer_.movingAverageWindow()
+            && last_.action == MitigationAction::NONE
+            && last_.throttle_level == current_throttle;
+
+        if (settled) {
+            // Stamped from the balancer's clock, like the ticks balance() records
+            last_same_ = balancer_.now();
+            if (still_same_ == 0) first_same_ = last_same_;
+            ++still_same_;
+            ++coalesced_total_;
+            last_.timestamp = last_same_;
+            return last_;
+        }
+
+        flush();
+        ++held_run_;
+        last_ = balancer_.balance(held_, current_throttle);
+        return last_;
+    }
+
+    /**
+     * Coalesced ticks not yet replayed into the balancer history
+     */
+    std::uint64_t stillSameTicks() const { return still_same_; }
+
+    /**
+     * Total samples skipped since construction
+     */
+    std::uint64_t coalescedTotal() const { return coalesced_total_; }
+
+    /**
+     * Replay pending ticks now (e.g. before reading balancer history)
+     */
+    void sync() { flush(); }
+
+    const TelemetryData* held() const { return has_held_ ? &held_ : nullptr; }
+};
+
+} // namespace neural
+} // namespace synapse
+
+#endif // SYNAPSE_INGESTION_FILTER_HPP
@@ -0,0 +1,179 @@
+/**
+ * SYNAPSE Neural Connection Layer - ISR Telemetry Ring
+ * ====================================================
+ *
+ * Wait-free hand-off of raw telemetry from interrupt context to the main
+ * loop on bare-metal targets (embedded profile):
+ *
+ *   ISR:        ring.push(id, sample)            - never blocks, never loops
+ *   main loop:  drainAndBalance(ring, engine, now, on_result)
+ *
+ * Single producer, single consumer. The producer is one interrupt
+ * priority level (an ISR must not be preempted by another pushing to the
+ * same ring; give each priority its own ring). Only atomic loads and
+ * stores are used, no read-modify-write, so it works on ARMv6-M where
+ * LDREX/STREX do not exist; with acquire/release ordering it is also a
+ * correct SPSC queue between two threads on a hosted build.
+ *
+ * A full ring drops the new sample and counts it (dropped()); older
+ * samples are never overwritten under the consumer.
+ *
+ * WCET (bench/isr_ring_wcet reproduces the host figures; TSC ticks on
+ * x86-64 -O2, counter overhead subtracted, p99.9 / median of 10^6):
+ *
+ *   push()           straight-line, one branch (full check), no loops.
+ *                    Accepted path 19 instructions, dropped path 9.
+ *                    Host: 60 / 20 ticks. Cortex-M0 estimate from the
+ *                    instruction mix (not measured on hardware): ~30
+ *                    instructions, ~50 cycles including two DMBs.
+ *   drain()          two atomic loads + one store per batch plus the
+ *                    callback per sample: n * WCET(callback) + c.
+ *   drainAndBalance  n * WCET(EmbeddedEngine::tick); the tick has no
+ *                    data-dependent loops (the window sum is fixed
+ *                    length). Host: 500 / 210 ticks per sample.
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#ifndef SYNAPSE_ISR_TELEMETRY_RING_HPP
+#define SYNAPSE_ISR_TELEMETRY_RING_HPP
+
+#include "embedded_balancer.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#ifndef SYNAPSE_EMBEDDED_ISR_RING_CAPACITY
+#define SYNAPSE_EMBEDDED_ISR_RING_CAPACITY 16
+#endif
+
+namespace synapse {
+namespace neural {
+namespace embedded {
+
+template <typename T>
+struct TelemetrySample {
+    ComponentId id;
+    BasicTelemetry<T> telemetry;
+};
+
+/**
+ * Static single-producer / single-consumer telemetry ring
+ *
+ * Head and tail are free-running 32-bit counters; Capacity must be a
+ * power of two so they can wrap without a modulo.
+ */
+template <typename T = fixed::Q16_16, std::size_t Capacity = SYNAPSE_EMBEDDED_ISR_RING_CAPACITY>
+class IsrTelemetryRing {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "IsrTelemetryRing capacity must be a power of two");
+    static_assert(Capacity <= (std::uint32_t(1) << 31), "IsrTelemetryRing capacity too large");
+
+private:
+    static constexpr std::uint32_t MASK = static_cast<std::uint32_t>(Capacity - 1);
+
+    TelemetrySample<T> slots_[Capacity] = {};
+    std::atomic<std::uint32_t> head_{0};      // Written by the producer only
+    std::atomic<std::uint32_t> tail_{0};      // Written by the consumer only
+    std::atomic<std::uint32_t> dropped_{0};   // Written by the producer only
+
+public:
+    // -------------------------------------------------------------------------
+    // Producer side (interrupt context)
+    // -------------------------------------------------------------------------
+
+    /**
+     * Deposit one sample; wait-free
+     *
+     * @return false if the ring was full (sample dropped and counted)
+     */
+    bool push(ComponentId id, const BasicTelemetry<T>& telemetry) {
+        std::uint32_t head = head_.load(std::memory_order_relaxed);
+        std::uint32_t tail = tail_.load(std::memory_order_acquire);
+
+        if (head - tail == Capacity) {
+            // Single writer: load + store instead of fetch_add (no RMW on v6-M)
+            dropped_.store(dropped_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        TelemetrySample<T>& slot = slots_[head & MASK];
+        slot.id = id;
+        slot.telemetry = telemetry;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // -------------------------------------------------------------------------
+    // Consumer side (main loop)
+    // -------------------------------------------------------------------------
+
+    /**
+     * Hand up to `max` samples to fn(const TelemetrySample<T>&), oldest first
+     *
+     * The slots are released in one store after the batch, so the
+     * producer sees them free only once fn has returned for all of them.
+     *
+     * @return Number of samples drained
+     */
+    template <typename Fn>
+    std::size_t drain(Fn&& fn, std::size_t max = Capacity) {
+        std::uint32_t tail = tail_.load(std::memory_order_relaxed);
+        std::uint32_t head = head_.load(std::memory_order_acquire);
+
+        std::uint32_t count = head - tail;
+        if (count > max) count = static_cast<std::uint32_t>(max);
+
+        for (std::uint32_t i = 0; i < count; ++i) {
+            const TelemetrySample<T>& sample = slots_[(tail + i) & MASK];
+            fn(sample);
+        }
+
+        tail_.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    /**
+     * Samples waiting (exact from the consumer, a lower bound from the ISR)
+     */
+    std::size_t size() const {
+        return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+    }
+
+    bool empty() const { return size() == 0; }
+    static constexpr std::size_t capacity() { return Capacity; }
+
+    /**
+     * Samples rejected because the ring was full (wraps at 2^32)
+     */
+    std::uint32_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+};
+
+/**
+ * Drain the ring and run every sample through the engine, in arrival order
+ *
+ * Uses the IDI / health score last set with setIntegrationState().
+ * on_result(const TelemetrySample<T>&, const EngineResult<T>&) sees each
+ * decision (e.g. to apply the throttle or queue an alert).
+ *
+ * @param max Bound on samples handled per call (bounds main-loop latency)
+ * @return Number of samples balanced
+ */
+template <typename T, std::size_t Capacity, std::size_t MaxComponents, std::size_t Window, typename OnResult>
+std::size_t drainAndBalance(IsrTelemetryRing<T, Capacity>& ring,
+                            EmbeddedEngine<T, MaxComponents, Window>& engine,
+                            std::uint32_t now, OnResult&& on_result,
+                            std::size_t max = Capacity) {
+    return ring.drain([&](const TelemetrySample<T>& sample) {
+        EngineResult<T> result = engine.tick(sample.id, sample.telemetry, now);
+        on_result(sample, result);
+    }, max);
+}
+
+} // namespace embedded
+} // namespace neural
+} // namespace synapse
+
+#endif // SYNAPSE_ISR_TELEMETRY_RING_HPP
@@ -0,0 +1,300 @@
+/**
+ * SYNAPSE Neural Connection Layer - Multi-Resolution Metrics Rollups
+ * ==================================================================
+ *
+ * Keeps weeks of hw_capacity / sw_demand / imbalance trends per component
+ * in a fixed memory budget: raw samples stay in the balancer history,
+ * this store aggregates them into 1 s, 1 min and 1 h buckets.
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#ifndef SYNAPSE_METRICS_ROLLUP_HPP
+#define SYNAPSE_METRICS_ROLLUP_HPP
+
+#include "balancing_algorithm.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+namespace synapse {
+namespace neural {
+
+// =============================================================================
+// ROLLUP DATA STRUCTURES
+// =============================================================================
+
+enum class RollupResolution {
+    SECOND,
+    MINUTE,
+    HOUR
+};
+
+/**
+ * Running min / max / mean / count of one signal
+ */
+struct RollupStats {
+    double min = std::numeric_limits<double>::infinity();
+    double max = -std::numeric_limits<double>::infinity();
+    double sum = 0.0;
+    std::uint32_t count = 0;
+
+    void add(double value, std::uint32_t repeats = 1) {
+        min = std::min(min, value);
+        max = std::max(max, value);
+        sum += value * repeats;
+        count += repeats;
+    }
+
+    void merge(const RollupStats& other) {
+        min = std::min(min, other.min);
+        max = std::max(max, other.max);
+        sum += other.sum;
+        count += other.count;
+    }
+
+    double mean() const { return count ? sum / count : 0.0; }
+};
+
+struct RollupBucket {
+    std::int64_t start_seconds = -1;   // Bucket start (Unix seconds), -1 = empty
+    RollupStats hw_capacity;
+    RollupStats sw_demand;
+    RollupStats imbalance;
+
+    void add(const BalanceMetrics& metrics, std::uint32_t repeats = 1) {
+        hw_capacity.add(metrics.hw_capacity, repeats);
+        sw_demand.add(metrics.sw_demand, repeats);
+        imbalance.add(metrics.imbalance, repeats);
+    }
+
+    void merge(const RollupBucket& other) {
+        hw_capacity.merge(other.hw_capacity);
+        sw_demand.merge(other.sw_demand);
+        imbalance.merge(other.imbalance);
+    }
+};
+
+// =============================================================================
+// METRICS ROLLUP STORE
+// =============================================================================
+
+/**
+ * Per-component rollup store
+ *
+ * Each tier is a ring indexed by (bucket start / resolution) % slots, so
+ * recording a sample is O(tiers) and memory is fixed at construction:
+ * (SecondSlots + MinuteSlots + HourSlots) * sizeof(RollupBucket).
+ * Defaults keep 2 minutes of seconds, 2 hours of minutes, 2 weeks of hours.
+ *
+ * Attach with HardwareSoftwareBalancer::setMetricsSink().
+ */
+template <size_t SecondSlots = 120, size_t MinuteSlots = 120, size_t HourSlots = 24 * 14>
+class MetricsRollup : public BalanceMetricsSink {
+private:
+    static constexpr size_t TIER_COUNT = 3;
+    static constexpr std::int64_t RESOLUTION_SECONDS[TIER_COUNT] = {1, 60, 3600};
+
+    std::array<RollupBucket, SecondSlots> seconds_;
+    std::array<RollupBucket, MinuteSlots> minutes_;
+    std::array<RollupBucket, HourSlots> hours_;
+    mutable std::mutex mutex_;
+
+    static std::int64_t toSeconds(std::chrono::system_clock::time_point tp) {
+        return std::chrono::duration_cast<std::chrono::seconds>(tp.time_since_epoch()).count();
+    }
+
+    static std::int64_t floorDiv(std::int64_t a, std::int64_t b) {
+        std::int64_t q = a / b;
+        return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+    }
+
+    template <size_t N>
+    static void addToTier(std::array<RollupBucket, N>& tier, std::int64_t resolution,
+                          std::int64_t seconds, const BalanceMetrics& metrics,
+                          std::uint32_t repeats = 1) {
+        std::int64_t index = floorDiv(seconds, resolution);
+        RollupBucket& bucket = tier[static_cast<size_t>(index % static_cast<std::int64_t>(N))];
+        std::int64_t start = index * resolution;
+
+        if (bucket.start_seconds != start) {
+            // Slot held an older period - recycle it
+            if (bucket.start_seconds > start) return;  // Sample too old for this tier
+            bucket = RollupBucket{};
+            bucket.start_seconds = start;
+        }
+        bucket.add(metrics, repeats);
+    }
+
+    /**
+     * Repeats of a run (spaced as repeatTimestamp()) that fall before `seconds`
+     */
+    static std::uint64_t repeatsBefore(std::chrono::system_clock::time_point first,
+                                       std::chrono::system_clock::time_point last,
+                                       std::uint64_t count, std::int64_t seconds) {
+        std::uint64_t lo = 0, hi = count;
+        while (lo < hi) {
+            std::uint64_t mid = lo + (hi - lo) / 2;
+            if (toSeconds(repeatTimestamp(first, last, mid, count)) < seconds) lo = mid + 1;
+            else hi = mid;
+        }
+        return lo;
+    }
+
+    /**
+     * Add a coalesced run bucket by bucket, newest first. An older bucket
+     * whose slot a newer bucket of the run already took would only have
+     * been recycled, so it is skipped; the walk visits non-empty buckets
+     * only and stops once every slot is taken.
+     */
+    template <size_t N>
+    static void addRunToTier(std::array<RollupBucket, N>& tier, std::int64_t resolution,
+                             const BalanceMetrics& metrics, std::uint64_t count,
+                             std::chrono::system_clock::time_point first,
+                             std::chrono::system_clock::time_point last) {
+        std::array<bool, N> taken{};
+        size_t slots_taken = 0;
+
+        std::uint64_t upto = count;
+        while (upto > 0 && slots_taken < N) {
+            const std::int64_t index = floorDiv(toSeconds(repeatTimestamp(first, last, upto - 1, count)), resolution);
+            const std::uint64_t before = repeatsBefore(first, last, count, index * resolution);
+
+            const size_t slot = static_cast<size_t>(index % static_cast<std::int64_t>(N));
+            if (!taken[slot]) {
+                taken[slot] = true;
+                ++slots_taken;
+                // Added oldest-to-newest would give the same bucket: the
+                // slot's existing contents are recycled or kept either way
+                addToTier(tier, resolution, index * resolution, metrics,
+                          static_cast<std::uint32_t>(upto - before));
+            }
+            upto = before;
+        }
+    }
+
+    template <size_t N>
+    static void collect(const std::array<RollupBucket, N>& tier, std::int64_t from,
+                        std::int64_t to, std::vector<RollupBucket>& out) {
+        for (const auto& bucket : tier) {
+            if (bucket.start_seconds >= from && bucket.start_seconds < to) {
+                out.push_back(bucket);
+            }
+        }
+    }
+
+    static size_t tierIndex(RollupResolution resolution) {
+        return static_cast<size_t>(resolution);
+    }
+
+public:
+    static constexpr size_t slots(RollupResolution resolution) {
+        return resolution == RollupResolution::SECOND ? SecondSlots
+             : resolution == RollupResolution::MINUTE ? MinuteSlots
+             : HourSlots;
+    }
+
+    /**
+     * Oldest data a tier can still answer for, measured back from now
+     */
+    static constexpr std::chrono::seconds retention(RollupResolution resolution) {
+        return std::chrono::seconds(
+            static_cast<std::int64_t>(slots(resolution)) * RESOLUTION_SECONDS[tierIndex(resolution)]);
+    }
+
+    void record(const BalanceMetrics& metrics) {
+        const std::int64_t seconds = toSeconds(metrics.timestamp);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        addToTier(seconds_, RESOLUTION_SECONDS[0], seconds, metrics);
+        addToTier(minutes_, RESOLUTION_SECONDS[1], seconds, metrics);
+        addToTier(hours_, RESOLUTION_SECONDS[2], seconds, metrics);
+    }
+
+    /**
+     * Record `count` repeats of `metrics` spread evenly over [first, last]
+     *
+     * Costs O(slots x log count) whatever the run length.
+     */
+    void recordRepeated(const BalanceMetrics& metrics, std::uint64_t count,
+                        std::chrono::system_clock::time_point first,
+                        std::chrono::system_clock::time_point last) {
+        if (count == 0) return;
+        if (last < first) first = last;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        addRunToTier(seconds_, RESOLUTION_SECONDS[0], metrics, count, first, last);
+        addRunToTier(minutes_, RESOLUTION_SECONDS[1], metrics, count, first, last);
+        addRunToTier(hours_, RESOLUTION_SECONDS[2], metrics, count, first, last);
+    }
+
+    void onBalanceMetrics(const BalanceMetrics& metrics) override {
+        record(metrics);
+    }
+
+    void onRepeatedMetrics(const BalanceMetrics& metrics, std::uint64_t count,
+                           std::chrono::system_clock::time_point first,
+                           std::chrono::system_clock::time_point last) override {
+        recordRepeated(metrics, count, first, last);
+    }
+
+    /**
+     * Buckets of one resolution whose start lies in [from, to), oldest first
+     *
+     * Scans at most slots(resolution) buckets; raw samples are never read.
+     */
+    std::vector<RollupBucket> query(RollupResolution resolution,
+                                    std::chrono::system_clock::time_point from,
+                                    std::chrono::system_clock::time_point to) const {
+        std::vector<RollupBucket> result;
+        const std::int64_t f = toSeconds(from);
+        const std::int64_t t = toSeconds(to);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            switch (resolution) {
+                case RollupResolution::SECOND: collect(seconds_, f, t, result); break;
+                case RollupResolution::MINUTE: collect(minutes_, f, t, result); break;
+                case RollupResolution::HOUR:   collect(hours_, f, t, result); break;
+            }
+        }
+
+        std::sort(result.begin(), result.end(), [](const RollupBucket& a, const RollupBucket& b) {
+            return a.start_seconds < b.start_seconds;
+        });
+        return result;
+    }
+
+    /**
+     * Single aggregate over [from, to)
+     *
+     * Uses the finest tier whose retention still covers `from`.
+     */
+    RollupBucket summarize(std::chrono::system_clock::time_point from,
+                           std::chrono::system_clock::time_point to,
+                           std::chrono::system_clock::time_point now = std::chrono::system_clock::now()) const {
+        RollupResolution resolution = RollupResolution::HOUR;
+        if (now - from <= retention(RollupResolution::SECOND)) {
+            resolution = RollupResolution::SECOND;
+        } else if (now - from <= retention(RollupResolution::MINUTE)) {
+            resolution = RollupResolution::MINUTE;
+        }
+
+        RollupBucket total;
+        total.start_seconds = toSeconds(from);
+        for (const auto& bucket : query(resolution, from, to)) {
+            total.merge(bucket);
+        }
+        return total;
+    }
+};
+
+} // namespace neural
+} // namespace synapse
+
+#endif // SYNAPSE_METRICS_ROLLUP_HPP
@@ -0,0 +1,269 @@
+/**
+ * SYNAPSE Neural Connection Layer - Mitigation Statistics
+ * =======================================================
+ *
+ * Counters for every mitigation action (per flavor) and every severity
+ * transition. Each thread increments its own cache-line-aligned slot
+ * with plain relaxed stores; readers sum the slots on demand, so the
+ * hot path never contends on a shared cache line.
+ *
+ * Includes an OpenMetrics text exporter for a file descriptor or a
+ * loopback TCP port.
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#ifndef SYNAPSE_MITIGATION_STATS_HPP
+#define SYNAPSE_MITIGATION_STATS_HPP
+
+#include "balancing_algorithm.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace synapse {
+namespace neural {
+
+// =============================================================================
+// COUNTER LAYOUT
+// =============================================================================
+
+constexpr size_t FLAVOR_COUNT = 6;
+constexpr size_t ACTION_COUNT = 7;
+constexpr size_t SEVERITY_COUNT = 4;
+
+/**
+ * Aggregated view of all thread slots
+ */
+struct MitigationCounts {
+    std::array<std::array<std::uint64_t, ACTION_COUNT>, FLAVOR_COUNT> actions{};
+    std::array<std::array<std::uint64_t, SEVERITY_COUNT>, SEVERITY_COUNT> transitions{};
+
+    std::uint64_t action(FlavorType flavor, MitigationAction a) const {
+        return actions[static_cast<size_t>(flavor)][static_cast<size_t>(a)];
+    }
+
+    std::uint64_t transition(SeverityLevel from, SeverityLevel to) const {
+        return transitions[static_cast<size_t>(from)][static_cast<size_t>(to)];
+    }
+};
+
+// =============================================================================
+// MITIGATION STATS
+// =============================================================================
+
+/**
+ * Per-thread, false-sharing-free mitigation counters
+ *
+ * A thread's first record() on an instance registers a slot under the
+ * registry mutex; afterwards it is found through a thread_local cache
+ * keyed by instance id and updated with relaxed load/store pairs (single
+ * writer per slot, no RMW). Each (thread, instance) pair registers once,
+ * however the thread interleaves instances. Slots outlive their threads
+ * so totals never go backwards.
+ */
+class MitigationStats {
+private:
+    struct alignas(64) Slot {
+        std::atomic<std::uint64_t> actions[FLAVOR_COUNT][ACTION_COUNT];
+        std::atomic<std::uint64_t> transitions[SEVERITY_COUNT][SEVERITY_COUNT];
+
+        Slot() {
+            for (auto& row : actions) for (auto& c : row) c.store(0, std::memory_order_relaxed);
+            for (auto& row : transitions) for (auto& c : row) c.store(0, std::memory_order_relaxed);
+        }
+    };
+
+    struct Cache {
+        std::uint64_t owner = 0;
+        Slot* slot = nullptr;
+    };
+
+    const std::uint64_t id_;
+    mutable std::mutex registry_mutex_;
+    std::deque<Slot> slots_;
+
+    static std::uint64_t nextId() {
+        static std::atomic<std::uint64_t> counter{0};
+        return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    static void bump(std::atomic<std::uint64_t>& counter) {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    /**
+     * This thread's slot; the most recently used instance is kept at the
+     * back so the common single-instance case is one compare
+     */
+    Slot& local() {
+        static thread_local std::vector<Cache> cache;
+        if (!cache.empty() && cache.back().owner == id_) return *cache.back().slot;
+
+        for (size_t i = 0; i + 1 < cache.size(); ++i) {
+            if (cache[i].owner == id_) {
+                std::swap(cache[i], cache.back());
+                return *cache.back().slot;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+        slots_.emplace_back();
+        cache.push_back({id_, &slots_.back()});
+        return *cache.back().slot;
+    }
+
+public:
+    MitigationStats() : id_(nextId()) {}
+
+    MitigationStats(const MitigationStats&) = delete;
+    MitigationStats& operator=(const MitigationStats&) = delete;
+
+    void recordAction(FlavorType flavor, MitigationAction action) {
+        bump(local().actions[static_cast<size_t>(flavor)][static_cast<size_t>(action)]);
+    }
+
+    void record(FlavorType flavor, const MitigationResult& result) {
+        recordAction(flavor, result.action);
+    }
+
+    void recordTransition(SeverityLevel from, SeverityLevel to) {
+        if (from == to) return;
+        bump(local().transitions[static_cast<size_t>(from)][static_cast<size_t>(to)]);
+    }
+
+    /**
+     * Sum every thread's slot (lazy aggregation, read side only)
+     */
+    MitigationCounts snapshot() const {
+        MitigationCounts counts;
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+        for (const Slot& slot : slots_) {
+            for (size_t f = 0; f < FLAVOR_COUNT; ++f)
+                for (size_t a = 0; a < ACTION_COUNT; ++a)
+                    counts.actions[f][a] += slot.actions[f][a].load(std::memory_order_relaxed);
+            for (size_t from = 0; from < SEVERITY_COUNT; ++from)
+                for (size_t to = 0; to < SEVERITY_COUNT; ++to)
+                    counts.transitions[from][to] += slot.transitions[from][to].load(std::memory_order_relaxed);
+        }
+        return counts;
+    }
+
+    size_t threadSlots() const {
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+        return slots_.size();
+    }
+
+    static MitigationStats& global() {
+        static MitigationStats stats;
+        return stats;
+    }
+};
+
+// =============================================================================
+// OPENMETRICS EXPORTER
+// =============================================================================
+
+/**
+ * OpenMetrics text exposition of MitigationCounts
+ *
+ * Counters are cumulative; per-second rates come from the scraper
+ * (e.g. rate(synapse_mitigation_actions_total[1m])).
+ */
+class OpenMetricsExporter {
+public:
+    static std::string render(const MitigationCounts& counts) {
+        std::string out;
+        out.reserve(8192);
+
+        out += "# TYPE synapse_mitigation_actions counter\n";
+        out += "# HELP synapse_mitigation_actions Mitigation actions fired, by flavor and action.\n";
+        for (size_t f = 0; f < FLAVOR_COUNT; ++f) {
+            for (size_t a = 0; a < ACTION_COUNT; ++a) {
+                out += "synapse_mitigation_actions_total{flavor=\"";
+                out += toString(static_cast<FlavorType>(f));
+                out += "\",action=\"";
+                out += toString(static_cast<MitigationAction>(a));
+                out += "\"} ";
+                out += std::to_string(counts.actions[f][a]);
+                out += '\n';
+            }
+        }
+
+        out += "# TYPE synapse_severity_transitions counter\n";
+        out += "# HELP synapse_severity_transitions Severity level changes, by previous and new level.\n";
+        for (size_t from = 0; from < SEVERITY_COUNT; ++from) {
+            for (size_t to = 0; to < SEVERITY_COUNT; ++to) {
+                if (from == to) continue;
+                out += "synapse_severity_transitions_total{from=\"";
+                out += toString(static_cast<SeverityLevel>(from));
+                out += "\",to=\"";
+                out += toString(static_cast<SeverityLevel>(to));
+                out += "\"} ";
+                out += std::to_string(counts.transitions[from][to]);
+                out += '\n';
+            }
+        }
+
+        out += "# EOF\n";
+        return out;
+    }
+
+#if defined(__unix__) || defined(__APPLE__)
+    /**
+     * Write the exposition to an open file descriptor
+     *
+     * @return false on a write error (errno is preserved)
+     */
+    static bool writeTo(int fd, const MitigationCounts& counts) {
+        const std::string text = render(counts);
+        size_t written = 0;
+        while (written < text.size()) {
+            ssize_t n = ::write(fd, text.data() + written, text.size() - written);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                return false;
+            }
+            written += static_cast<size_t>(n);
+        }
+        return true;
+    }
+
+    /**
+     * Push the exposition to a collector listening on 127.0.0.1:port
+     */
+    static bool sendToLoopback(std::uint16_t port, const MitigationCounts& counts) {
+        int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0) return false;
+
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(port);
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+        bool ok = ::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0
+               && writeTo(fd, counts);
+        ::close(fd);
+        return ok;
+    }
+#endif
+};
+
+} // namespace neural
+} // namespace synapse
+
+#endif // SYNAPSE_MITIGATION_STATS_HPP
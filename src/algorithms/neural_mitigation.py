@@ -22,8 +22,15 @@ from enum import Enum
 from datetime import datetime, timedelta
 import math
 import asyncio
+from array import array
 from collections import deque
 
+# Opsiyonel C++ motoru (python setup.py build_ext --inplace); yoksa saf Python
+try:
+    import _synapse_native as _native
+except ImportError:
+    _native = None
+
 # Flavor desteği için import (circular import önlemek için lazy)
 if TYPE_CHECKING:
     from synapse_flavors import SynapseFlavor, FlavorType
@@ -165,6 +172,20 @@ class SynapseThresholds:
     HW_SW_IMBALANCE_THRESHOLD = 0.3  # 30% imbalance triggers rebalancing
 
 
+def _threshold_values() -> tuple:
+    return tuple(getattr(SynapseThresholds, name)
+                 for name in sorted(vars(SynapseThresholds)) if name.isupper())
+
+
+# Native motor C++ varsayılan eşiklerini kullanır (yukarıdaki değerlerle aynı);
+# SynapseThresholds çalışma anında değiştirilirse saf Python yoluna düşülür
+_NATIVE_THRESHOLDS = _threshold_values()
+
+
+def _native_thresholds_match() -> bool:
+    return _native is not None and _threshold_values() == _NATIVE_THRESHOLDS
+
+
 # =============================================================================
 # CORE ALGORITHMS
 # =============================================================================
@@ -182,6 +203,12 @@ class IDICalculator:
     @staticmethod
     def calculate(days: int, loc_changed: int, dependencies: int) -> float:
         """IDI hesapla"""
+        if _native is not None:
+            try:
+                return round(_native.idi_calculate(days, loc_changed, dependencies), 2)
+            except (OverflowError, TypeError):
+                pass  # int32 dışı / int olmayan girdiler saf Python yolundan
+
         d = max(days, 0)
         l = max(loc_changed, 0) / 1000.0
         dep = max(dependencies, 1) / 10.0
@@ -189,6 +216,22 @@ class IDICalculator:
         idi = d * l * dep
         return round(idi, 2)
 
+    @staticmethod
+    def calculate_batch(days, loc_changed, dependencies) -> array:
+        """
+        Toplu IDI hesapla - calculate() ile aynı (2 basamağa yuvarlanmış) sonuçlar
+
+        Girdiler buffer-protocol dizileri (array.array, NumPy) ise native
+        motor kopyalamadan okur; diğer diziler saf Python ile hesaplanır.
+        """
+        if _native is not None:
+            try:
+                return _native.idi_calculate_batch(days, loc_changed, dependencies, ndigits=2)
+            except (TypeError, OverflowError):
+                pass
+        return array('d', (IDICalculator.calculate(d, l, dep)
+                           for d, l, dep in zip(days, loc_changed, dependencies)))
+
     @staticmethod
     def get_severity(idi: float) -> SeverityLevel:
         """IDI'ye göre ciddiyet seviyesi"""
@@ -432,6 +475,9 @@ class IDIBrake:
 
         Returns: 0.0 (tam durdurma) - 1.0 (tam hız)
         """
+        if _native_thresholds_match():
+            return _native.brake_throttle_level(idi)
+
         if idi < SynapseThresholds.IDI_HEALTHY:
             return 1.0  # Full speed
 
@@ -526,6 +572,7 @@ class HardwareSoftwareBalancer:
     def __init__(self):
         self.balance_history: List[Dict] = []
         self.moving_avg_window = 10
+        self._native = _native.Balancer() if _native is not None else None
 
     def calculate_hardware_capacity(self, telemetry: TelemetryData) -> float:
         """
@@ -533,6 +580,10 @@ class HardwareSoftwareBalancer:
 
         Yüksek skor = Daha fazla kapasite mevcut
         """
+        if self._native is not None and _native_thresholds_match():
+            return round(self._native.hardware_capacity(
+                telemetry.cpu_usage, telemetry.memory_usage, telemetry.temperature), 2)
+
         # CPU kapasitesi (ters orantılı)
         cpu_capacity = 100 - telemetry.cpu_usage
 
@@ -561,6 +612,11 @@ class HardwareSoftwareBalancer:
 
         Yüksek skor = Daha fazla kaynak talebi
         """
+        if (self._native is not None and target_throughput == self._native.target_throughput
+                and _native_thresholds_match()):
+            return round(self._native.software_demand(
+                telemetry.throughput, telemetry.io_latency_ms, telemetry.error_rate), 2)
+
         # Throughput bazlı talep
         throughput_demand = min((telemetry.throughput / target_throughput) * 100, 100)
 
@@ -852,6 +908,80 @@ class AdaptiveThrottling:
         return round(new_throttle, 2)
 
 
+# =============================================================================
+# CHANGE NOTIFIER - Kenar Tetiklemeli Bildirim
+# =============================================================================
+
+@dataclass
+class ChangeNotifierConfig:
+    """Kenar tetiklemeli bildirim ayarları (change_notifier.hpp ile aynı)"""
+    throttle_step: float = 0.05                # Throttle bu adımın katları olarak raporlanır
+    throttle_hysteresis: float = 0.01          # Yarım adım sınırının ötesindeki ek bant
+    max_silence: Optional[timedelta] = None    # Değişmeyen durumu bu süre sonra yeniden bildir
+
+
+class ChangeNotifier:
+    """
+    Bileşen başına son bildirilen aksiyonu ve kuantize throttle seviyesini
+    tutar; yalnızca geçişleri bildirir.
+
+    Her bileşen NONE / tam hız (1.0) ile başlar: sağlıklı bir bileşen hiç
+    event üretmez. Her sonuç akışı (fren, dengeleme) için ayrı bir
+    notifier kullanılmalıdır.
+    """
+
+    def __init__(self, config: Optional[ChangeNotifierConfig] = None):
+        self.config = config or ChangeNotifierConfig()
+        self._boundary = 0.5 + self.config.throttle_hysteresis / self.config.throttle_step
+        self._states: Dict[str, Dict] = {}
+        self.observed_total = 0
+        self.emitted_total = 0
+
+    def _quantize(self, throttle: float) -> int:
+        return math.floor(throttle / self.config.throttle_step + 0.5)
+
+    def observe(self, result: MitigationResult, throttle_level: float) -> Optional[Dict]:
+        """Sonucu işle; değişiklik varsa geçiş bilgisini döndür"""
+        self.observed_total += 1
+
+        state = self._states.get(result.component_id)
+        if state is None:
+            state = {"action": MitigationAction.NONE,
+                     "level": self._quantize(1.0),
+                     "last_emitted": result.timestamp}
+            self._states[result.component_id] = state
+
+        previous_action = state["action"]
+        previous_level = state["level"]
+
+        if result.action != state["action"]:
+            reason = "action"
+            state["action"] = result.action
+            state["level"] = self._quantize(throttle_level)
+        elif abs(throttle_level / self.config.throttle_step - state["level"]) > self._boundary:
+            reason = "throttle"
+            state["level"] = self._quantize(throttle_level)
+        elif (self.config.max_silence is not None
+              and result.timestamp - state["last_emitted"] >= self.config.max_silence):
+            reason = "heartbeat"
+        else:
+            return None
+
+        state["last_emitted"] = result.timestamp
+        self.emitted_total += 1
+        return {
+            "reason": reason,
+            "previous_action": previous_action.value,
+            "action": result.action.value,
+            "previous_throttle": previous_level * self.config.throttle_step,
+            "throttle": state["level"] * self.config.throttle_step,
+        }
+
+    def forget(self, component_id: str):
+        """Bileşen durumunu sil"""
+        self._states.pop(component_id, None)
+
+
 # =============================================================================
 # NEURAL ORCHESTRA - Ana Koordinatör
 # =============================================================================
@@ -864,7 +994,8 @@ class NeuralOrchestra:
     koordine eder ve kararlar alır.
     """
 
-    def __init__(self):
+    def __init__(self, edge_triggered: bool = False,
+                 change_config: Optional[ChangeNotifierConfig] = None):
         self.idi_brake = IDIBrake()
         self.balancer = HardwareSoftwareBalancer()
         self.pruner = NeuralPruning()
@@ -873,6 +1004,15 @@ class NeuralOrchestra:
         self.components: Dict[str, ComponentState] = {}
         self.event_handlers: List[Callable[[MitigationResult], None]] = []
 
+        # Kenar tetiklemeli mod: fren ve dengeleme sonuçları yalnızca
+        # aksiyon / throttle değiştiğinde yayınlanır
+        self.notifiers: Optional[Dict[str, ChangeNotifier]] = None
+        if edge_triggered:
+            self.notifiers = {
+                "idi": ChangeNotifier(change_config),
+                "balance": ChangeNotifier(change_config),
+            }
+
     def register_component(self, component: ComponentState):
         """Bileşen kaydet"""
         self.components[component.id] = component
@@ -881,6 +1021,25 @@ class NeuralOrchestra:
         """Mitigasyon event handler ekle"""
         self.event_handlers.append(handler)
 
+    @staticmethod
+    def _result_throttle(result: MitigationResult, component: ComponentState) -> float:
+        """Sonucun önerdiği throttle seviyesi (yoksa mevcut seviye)"""
+        for key in ("throttle_level", "new_throttle_level", "new_throttle"):
+            if key in result.details:
+                return result.details[key]
+        return component.throttle_level
+
+    def _should_emit(self, stream: str, result: MitigationResult, component: ComponentState) -> bool:
+        """Seviye modunda NONE dışı her sonuç, kenar modunda yalnızca geçişler"""
+        if self.notifiers is None:
+            return result.action != MitigationAction.NONE
+
+        change = self.notifiers[stream].observe(result, self._result_throttle(result, component))
+        if change is None:
+            return False
+        result.details["change"] = change
+        return True
+
     def _emit_event(self, result: MitigationResult):
         """Event'i tüm handler'lara gönder"""
         for handler in self.event_handlers:
@@ -906,7 +1065,7 @@ class NeuralOrchestra:
 
         # 1. IDI Freni kontrolü
         idi_result = self.idi_brake.apply_brake(component)
-        if idi_result.action != MitigationAction.NONE:
+        if self._should_emit("idi", idi_result, component):
             results.append(idi_result)
             self._emit_event(idi_result)
 
@@ -920,7 +1079,7 @@ class NeuralOrchestra:
         # 3. Eğer karantinada değilse, dengeleme yap
         if not component.is_quarantined:
             balance_result = self.balancer.balance(component, telemetry)
-            if balance_result.action != MitigationAction.NONE:
+            if self._should_emit("balance", balance_result, component):
                 results.append(balance_result)
                 self._emit_event(balance_result)
 
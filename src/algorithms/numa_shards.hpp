@@ -0,0 +1,442 @@
+/**
+ * SYNAPSE Neural Connection Layer - NUMA-Aware Component Shards
+ * =============================================================
+ *
+ * Partitions component state per NUMA node on multi-socket ingest hosts:
+ * each shard allocates from memory bound to its node (optionally huge
+ * pages), ingestion threads are pinned to the same node, and every
+ * access records whether it came from the local or a remote node.
+ *
+ * Linux only; other platforms fall back to a single node and the
+ * default allocator.
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#ifndef SYNAPSE_NUMA_SHARDS_HPP
+#define SYNAPSE_NUMA_SHARDS_HPP
+
+#include "balancing_algorithm.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace synapse {
+namespace neural {
+namespace numa {
+
+// =============================================================================
+// TOPOLOGY
+// =============================================================================
+
+/**
+ * NUMA node / CPU layout read from /sys/devices/system/node
+ *
+ * Node IDs can be sparse (offline or absent nodes), so nodes are listed
+ * from the `online` mask and addressed by ID; index 0..nodeCount()-1
+ * enumerates them in ascending ID order.
+ */
+class Topology {
+private:
+    std::vector<int> node_ids_;
+    std::vector<std::vector<int>> node_cpus_;    // Parallel to node_ids_
+    std::vector<int> cpu_node_;                  // Node ID per CPU
+
+    static std::vector<int> parseCpuList(const std::string& list) {
+        std::vector<int> cpus;
+        size_t pos = 0;
+        while (pos < list.size()) {
+            size_t end = list.find(',', pos);
+            if (end == std::string::npos) end = list.size();
+            std::string range = list.substr(pos, end - pos);
+            size_t dash = range.find('-');
+            if (!range.empty() && range[0] >= '0' && range[0] <= '9') {
+                int first = std::stoi(range.substr(0, dash));
+                int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+                for (int cpu = first; cpu <= last; ++cpu) cpus.push_back(cpu);
+            }
+            pos = end + 1;
+        }
+        return cpus;
+    }
+
+public:
+    Topology() {
+#if defined(__linux__)
+        std::ifstream online("/sys/devices/system/node/online");
+        std::string mask;
+        if (online && std::getline(online, mask)) {
+            for (int node : parseCpuList(mask)) {
+                std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+                std::string list;
+                if (!file || !std::getline(file, list)) continue;
+                node_ids_.push_back(node);
+                node_cpus_.push_back(parseCpuList(list));
+            }
+        }
+#endif
+        if (node_ids_.empty()) {
+            // No NUMA information - one node with every CPU
+            std::vector<int> cpus;
+            unsigned count = std::max(std::thread::hardware_concurrency(), 1u);
+            for (unsigned cpu = 0; cpu < count; ++cpu) cpus.push_back(static_cast<int>(cpu));
+            node_ids_.push_back(0);
+            node_cpus_.push_back(std::move(cpus));
+        }
+
+        for (size_t index = 0; index < node_ids_.size(); ++index) {
+            for (int cpu : node_cpus_[index]) {
+                if (cpu >= static_cast<int>(cpu_node_.size())) cpu_node_.resize(cpu + 1, node_ids_[0]);
+                cpu_node_[cpu] = node_ids_[index];
+            }
+        }
+    }
+
+    size_t nodeCount() const { return node_ids_.size(); }
+    int nodeId(size_t index) const { return node_ids_[index]; }
+
+    /**
+     * Index of a node ID, or -1 when it is not online
+     */
+    int indexOf(int node) const {
+        for (size_t index = 0; index < node_ids_.size(); ++index) {
+            if (node_ids_[index] == node) return static_cast<int>(index);
+        }
+        return -1;
+    }
+
+    const std::vector<int>& cpus(int node) const {
+        static const std::vector<int> none;
+        int index = indexOf(node);
+        return index < 0 ? none : node_cpus_[static_cast<size_t>(index)];
+    }
+
+    int nodeOfCpu(int cpu) const {
+        return cpu >= 0 && cpu < static_cast<int>(cpu_node_.size()) ? cpu_node_[cpu] : node_ids_[0];
+    }
+
+    static const Topology& system() {
+        static const Topology topology;
+        return topology;
+    }
+};
+
+namespace detail {
+    inline thread_local int pinned_node = -1;
+}
+
+/**
+ * Node the calling thread runs on (cached once the thread is pinned)
+ */
+inline int currentNode() {
+    if (detail::pinned_node >= 0) return detail::pinned_node;
+#if defined(__linux__)
+    return Topology::system().nodeOfCpu(sched_getcpu());
+#else
+    return 0;
+#endif
+}
+
+/**
+ * Restrict the calling thread to the CPUs of one node
+ *
+ * @return false if the affinity call failed (thread left unpinned)
+ */
+inline bool pinCurrentThreadToNode(int node) {
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : Topology::system().cpus(node)) CPU_SET(cpu, &set);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) return false;
+#endif
+    detail::pinned_node = node;
+    return true;
+}
+
+/**
+ * Start a thread that pins itself to `node` before running fn
+ */
+template <typename Fn>
+std::thread spawnOnNode(int node, Fn&& fn) {
+    return std::thread([node, fn = std::forward<Fn>(fn)]() mutable {
+        pinCurrentThreadToNode(node);
+        fn();
+    });
+}
+
+// =============================================================================
+// NODE-BOUND MEMORY
+// =============================================================================
+
+/**
+ * Memory resource whose pages are bound to one NUMA node
+ *
+ * Maps anonymous memory, binds it with mbind(MPOL_BIND) and pre-faults
+ * it so placement does not depend on which thread touches it first.
+ * Meant as the upstream of a pool resource: every call is an mmap.
+ */
+class NodeMemoryResource : public std::pmr::memory_resource {
+private:
+    int node_;
+    bool huge_pages_;
+
+    static constexpr int MPOL_BIND_MODE = 2;
+    static constexpr unsigned MPOL_MF_MOVE_FLAG = 1u << 1;
+    static constexpr size_t PAGE_SIZE = 4096;
+    static constexpr size_t HUGE_PAGE_SIZE = 2u << 20;
+
+    size_t mappedSize(size_t bytes) const {
+        const size_t page = huge_pages_ ? HUGE_PAGE_SIZE : PAGE_SIZE;
+        return (bytes + page - 1) / page * page;
+    }
+
+#if defined(__linux__)
+    /**
+     * Anonymous mapping of `length` bytes aligned to `alignment`
+     *
+     * mmap only guarantees `page` alignment, so larger alignments map
+     * `alignment` extra bytes and unmap the slack on both sides; what is
+     * left is exactly [result, result + length).
+     */
+    static void* mapAligned(size_t length, size_t alignment, size_t page, int flags) {
+        const int mode = MAP_PRIVATE | MAP_ANONYMOUS | flags;
+        if (alignment <= page) return mmap(nullptr, length, PROT_READ | PROT_WRITE, mode, -1, 0);
+
+        void* raw = mmap(nullptr, length + alignment, PROT_READ | PROT_WRITE, mode, -1, 0);
+        if (raw == MAP_FAILED) return raw;
+
+        const auto start = reinterpret_cast<std::uintptr_t>(raw);
+        const std::uintptr_t aligned = (start + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+        const size_t head = aligned - start;
+        if (head) munmap(raw, head);
+        if (alignment - head) munmap(reinterpret_cast<void*>(aligned + length), alignment - head);
+        return reinterpret_cast<void*>(aligned);
+    }
+#endif
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+#if defined(__linux__)
+        const size_t length = mappedSize(bytes);
+        void* p = MAP_FAILED;
+        if (huge_pages_) {
+            p = mapAligned(length, alignment, HUGE_PAGE_SIZE, MAP_HUGETLB);
+        }
+        if (p == MAP_FAILED) {
+            p = mapAligned(length, alignment, PAGE_SIZE, 0);
+            if (p == MAP_FAILED) throw std::bad_alloc();
+            // Transparent huge pages as a fallback for hugetlbfs
+            if (huge_pages_) madvise(p, length, MADV_HUGEPAGE);
+        }
+
+        unsigned long mask[16] = {};
+        if (node_ >= 0 && node_ < static_cast<int>(sizeof(mask) * 8)) {
+            mask[node_ / 64] = 1ul << (node_ % 64);
+            // Best effort: without CAP_SYS_NICE / NUMA the memory stays local-first
+            syscall(SYS_mbind, p, length, MPOL_BIND_MODE, mask, sizeof(mask) * 8, MPOL_MF_MOVE_FLAG);
+        }
+
+        // Pre-fault so pages land on the bound node now
+        for (size_t offset = 0; offset < length; offset += PAGE_SIZE) {
+            static_cast<volatile char*>(p)[offset] = 0;
+        }
+        return p;
+#else
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+#endif
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+#if defined(__linux__)
+        (void)alignment;
+        munmap(p, mappedSize(bytes));
+#else
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+#endif
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+public:
+    explicit NodeMemoryResource(int node, bool huge_pages = false)
+        : node_(node), huge_pages_(huge_pages) {}
+
+    int node() const { return node_; }
+};
+
+// =============================================================================
+// SHARDS
+// =============================================================================
+
+struct alignas(64) AccessCounters {
+    std::atomic<std::uint64_t> local{0};
+    std::atomic<std::uint64_t> remote{0};
+};
+
+/**
+ * Component state owned by one NUMA node
+ *
+ * Balancers (objects and their history) live in the shard's node-bound
+ * pool. The pool is synchronized, since every balancer in the shard
+ * allocates history from it and remote threads may balance components
+ * concurrently. add() grows the shard's table and must not overlap
+ * other access to the same shard: register from the node's owning
+ * thread before or between its ingestion passes.
+ */
+class ComponentShard {
+private:
+    int node_;
+    NodeMemoryResource upstream_;
+    std::pmr::synchronized_pool_resource pool_;
+    std::pmr::deque<HardwareSoftwareBalancer> balancers_;
+    AccessCounters counters_;
+
+public:
+    ComponentShard(int node, bool huge_pages)
+        : node_(node),
+          upstream_(node, huge_pages),
+          pool_(std::pmr::pool_options{0, 0}, &upstream_),
+          balancers_(&pool_) {}
+
+    ComponentShard(const ComponentShard&) = delete;
+    ComponentShard& operator=(const ComponentShard&) = delete;
+
+    int node() const { return node_; }
+    size_t size() const { return balancers_.size(); }
+
+    size_t add(double target_throughput) {
+        balancers_.emplace_back(target_throughput, &pool_);
+        return balancers_.size() - 1;
+    }
+
+    HardwareSoftwareBalancer& access(size_t local_index) {
+        if (currentNode() == node_) {
+            counters_.local.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            counters_.remote.fetch_add(1, std::memory_order_relaxed);
+        }
+        return balancers_[local_index];
+    }
+
+    std::uint64_t localAccesses() const { return counters_.local.load(std::memory_order_relaxed); }
+    std::uint64_t remoteAccesses() const { return counters_.remote.load(std::memory_order_relaxed); }
+};
+
+/**
+ * Balancers for the whole fleet, partitioned across NUMA nodes
+ *
+ * A component lives on the shard of the node that registered it, and
+ * handles are interleaved: handle = local index * shards + shard index,
+ * so lookup is two integer ops. The set keeps no shared mutable state
+ * besides the shards, so each node's ingestion thread can register and
+ * balance its own components concurrently with the other nodes.
+ */
+class ShardedBalancerSet {
+private:
+    std::vector<std::unique_ptr<ComponentShard>> shards_;
+
+public:
+    struct ShardStats {
+        int node;
+        size_t components;
+        std::uint64_t local_accesses;
+        std::uint64_t remote_accesses;
+    };
+
+    explicit ShardedBalancerSet(bool huge_pages = false,
+                                const Topology& topology = Topology::system()) {
+        for (size_t index = 0; index < topology.nodeCount(); ++index) {
+            shards_.push_back(std::make_unique<ComponentShard>(topology.nodeId(index), huge_pages));
+        }
+    }
+
+    size_t shardCount() const { return shards_.size(); }
+
+    /**
+     * Shard index of a node ID (shard 0 for a node without a shard)
+     */
+    size_t shardOf(int node) const {
+        for (size_t index = 0; index < shards_.size(); ++index) {
+            if (shards_[index]->node() == node) return index;
+        }
+        return 0;
+    }
+
+    /**
+     * Node ID owning a handle
+     */
+    int nodeOf(ComponentHandle handle) const {
+        return shards_[handle % shards_.size()]->node();
+    }
+
+    /**
+     * Register a component on the calling thread's node
+     *
+     * Like every other mutation of a shard, call it from the thread that
+     * owns the node's shard (see ComponentShard), e.g. the ingestion
+     * thread started with spawnOnNode().
+     */
+    ComponentHandle add(double target_throughput = 1000.0) {
+        const size_t shard = shardOf(currentNode());
+        const size_t local_index = shards_[shard]->add(target_throughput);
+        return static_cast<ComponentHandle>(local_index * shards_.size() + shard);
+    }
+
+    HardwareSoftwareBalancer& balancer(ComponentHandle handle) {
+        return shards_[handle % shards_.size()]->access(handle / shards_.size());
+    }
+
+    MitigationResult balance(ComponentHandle handle, const TelemetryData& telemetry,
+                             double current_throttle) {
+        return balancer(handle).balance(telemetry, current_throttle);
+    }
+
+    /**
+     * Handles owned by one node, for that node's ingestion thread
+     */
+    std::vector<ComponentHandle> handlesOn(int node) const {
+        std::vector<ComponentHandle> handles;
+        const size_t shard = shardOf(node);
+        const size_t count = shards_[shard]->size();
+        for (size_t local_index = 0; local_index < count; ++local_index) {
+            handles.push_back(static_cast<ComponentHandle>(local_index * shards_.size() + shard));
+        }
+        return handles;
+    }
+
+    /**
+     * Local vs cross-node access counters, to verify the layout
+     */
+    std::vector<ShardStats> stats() const {
+        std::vector<ShardStats> result;
+        for (const auto& shard : shards_) {
+            result.push_back({shard->node(), shard->size(),
+                              shard->localAccesses(), shard->remoteAccesses()});
+        }
+        return result;
+    }
+};
+
+} // namespace numa
+} // namespace neural
+} // namespace synapse
+
+#endif // SYNAPSE_NUMA_SHARDS_HPP
@@ -29,6 +29,12 @@ import random
 import math
 import json
 
+# Opsiyonel C++ motoru (python setup.py build_ext --inplace); yoksa saf Python
+try:
+    import _synapse_native as _native
+except ImportError:
+    _native = None
+
 
 # =============================================================================
 # DATA CLASSES
@@ -199,6 +205,12 @@ class IDISimulator:
     @staticmethod
     def calculate_idi(days: int, loc: int, deps: int) -> float:
         """IDI hesapla"""
+        if _native is not None:
+            try:
+                return _native.idi_calculate(days, loc, deps)
+            except (OverflowError, TypeError):
+                pass
+
         d = max(days, 0)
         l = max(loc, 0) / 1000.0
         dep = max(deps, 1) / 10.0
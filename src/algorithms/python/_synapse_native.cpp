@@ -0,0 +1,731 @@
+/**
+ * SYNAPSE Native Engine - CPython extension
+ * =========================================
+ *
+ * Exposes IDICalculator, IDIBrake and HardwareSoftwareBalancer from
+ * balancing_algorithm.hpp, the git history scan of git_history.hpp and
+ * idi_cache.hpp, and the commit classifier of commit_classifier.hpp
+ * to neural_mitigation.py, idi_lock.py and project_simulator.py, which
+ * import it optionally and fall back to their pure-Python formulas when
+ * it is not built.
+ *
+ * Batch functions take any C-contiguous buffer-protocol object
+ * (array.array, NumPy arrays, memoryview) without copying: integer
+ * inputs may be 8/16/32/64-bit signed, float inputs and outputs are
+ * native doubles. Outputs are written into `out` when given, otherwise
+ * a new array.array is returned. The GIL is released while looping.
+ *
+ * Build:
+ *   python setup.py build_ext --inplace      (from src/algorithms)
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include "balancing_algorithm.hpp"
+#include "commit_classifier.hpp"
+#include "git_history.hpp"
+#include "idi_cache.hpp"
+
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <exception>
+#include <new>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace synapse::neural;
+
+namespace {
+
+// =============================================================================
+// BUFFER HELPERS
+// =============================================================================
+
+enum class Kind { INT, DOUBLE };
+
+/**
+ * RAII Py_buffer with element-kind validation
+ */
+class Buffer {
+private:
+    Py_buffer view_{};
+    bool held_ = false;
+
+    static const char* stripByteOrder(const char* format) {
+        if (!format) return "B";
+        if (*format == '@' || *format == '=') return format + 1;
+#if PY_LITTLE_ENDIAN
+        if (*format == '<') return format + 1;
+#else
+        if (*format == '>' || *format == '!') return format + 1;
+#endif
+        return format;
+    }
+
+public:
+    Buffer() = default;
+    Buffer(const Buffer&) = delete;
+    Buffer& operator=(const Buffer&) = delete;
+    ~Buffer() { if (held_) PyBuffer_Release(&view_); }
+
+    bool acquire(PyObject* obj, Kind kind, bool writable, const char* name) {
+        int flags = PyBUF_FORMAT | PyBUF_C_CONTIGUOUS | (writable ? PyBUF_WRITABLE : 0);
+        if (PyObject_GetBuffer(obj, &view_, flags) != 0) return false;
+        held_ = true;
+
+        const char* format = stripByteOrder(view_.format);
+        bool ok = format[0] != '\0' && format[1] == '\0';
+        if (ok && kind == Kind::DOUBLE) {
+            ok = format[0] == 'd';
+        } else if (ok) {
+            ok = std::strchr("bhilq", format[0]) != nullptr;
+        }
+        if (!ok) {
+            PyErr_Format(PyExc_TypeError, "%s: expected a buffer of %s, got format '%s'",
+                         name, kind == Kind::DOUBLE ? "float64" : "signed integers",
+                         view_.format ? view_.format : "B");
+            return false;
+        }
+        return true;
+    }
+
+    Py_ssize_t size() const { return view_.len / view_.itemsize; }
+    Py_ssize_t itemsize() const { return view_.itemsize; }
+
+    double* doubles() const { return static_cast<double*>(view_.buf); }
+    std::int32_t* int32s() const { return static_cast<std::int32_t*>(view_.buf); }
+
+    long long integer(Py_ssize_t i) const {
+        switch (view_.itemsize) {
+            case 1: return static_cast<const signed char*>(view_.buf)[i];
+            case 2: return static_cast<const short*>(view_.buf)[i];
+            case 4: return static_cast<const std::int32_t*>(view_.buf)[i];
+            default: return static_cast<const long long*>(view_.buf)[i];
+        }
+    }
+};
+
+/**
+ * Output buffer: the caller's `out` or a fresh array.array(typecode, n)
+ */
+PyObject* outputArray(PyObject* out, char typecode, Py_ssize_t count) {
+    if (out && out != Py_None) {
+        Py_INCREF(out);
+        return out;
+    }
+
+    PyObject* array_module = PyImport_ImportModule("array");
+    if (!array_module) return nullptr;
+
+    const Py_ssize_t itemsize = typecode == 'd' ? 8 : 4;
+    PyObject* zeros = PyBytes_FromStringAndSize(nullptr, count * itemsize);
+    PyObject* result = nullptr;
+    if (zeros) {
+        std::memset(PyBytes_AS_STRING(zeros), 0, static_cast<size_t>(count * itemsize));
+        result = PyObject_CallMethod(array_module, "array", "CO", typecode, zeros);
+        Py_DECREF(zeros);
+    }
+    Py_DECREF(array_module);
+    return result;
+}
+
+bool checkSize(const Buffer& buffer, Py_ssize_t expected, const char* name) {
+    if (buffer.size() == expected) return true;
+    PyErr_Format(PyExc_ValueError, "%s: expected %zd elements, got %zd", name, expected, buffer.size());
+    return false;
+}
+
+/**
+ * Python round(value, ndigits) for ndigits >= 0
+ *
+ * Both CPython and glibc print the exact binary value correctly rounded
+ * (ties to even), so formatting and re-parsing matches Python bit for bit.
+ */
+double roundDigits(double value, int ndigits) {
+    if (!std::isfinite(value)) return value;
+    char text[400];
+    std::snprintf(text, sizeof(text), "%.*f", ndigits, value);
+    return std::strtod(text, nullptr);
+}
+
+// =============================================================================
+// IDI / BRAKE
+// =============================================================================
+
+PyObject* idiCalculate(PyObject*, PyObject* args) {
+    int days = 0, loc_changed = 0, dependencies = 0;
+    if (!PyArg_ParseTuple(args, "iii:idi_calculate", &days, &loc_changed, &dependencies)) return nullptr;
+    return PyFloat_FromDouble(IDICalculator::calculate(days, loc_changed, dependencies));
+}
+
+PyObject* idiSeverity(PyObject*, PyObject* args) {
+    double idi = 0.0;
+    if (!PyArg_ParseTuple(args, "d:idi_severity", &idi)) return nullptr;
+    return PyLong_FromLong(static_cast<long>(IDICalculator::getSeverity(idi)));
+}
+
+PyObject* brakeThrottleLevel(PyObject*, PyObject* args) {
+    double idi = 0.0;
+    if (!PyArg_ParseTuple(args, "d:brake_throttle_level", &idi)) return nullptr;
+    return PyFloat_FromDouble(IDIBrake::calculateThrottleLevel(idi));
+}
+
+PyObject* idiCalculateBatch(PyObject*, PyObject* args, PyObject* kwargs) {
+    static const char* keywords[] = {"days", "loc_changed", "dependencies", "out", "ndigits", nullptr};
+    PyObject *days_obj, *loc_obj, *deps_obj, *out_obj = nullptr;
+    int ndigits = -1;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO|Oi:idi_calculate_batch",
+                                     const_cast<char**>(keywords),
+                                     &days_obj, &loc_obj, &deps_obj, &out_obj, &ndigits)) {
+        return nullptr;
+    }
+
+    Buffer days, loc, deps;
+    if (!days.acquire(days_obj, Kind::INT, false, "days")) return nullptr;
+    if (!loc.acquire(loc_obj, Kind::INT, false, "loc_changed")) return nullptr;
+    if (!deps.acquire(deps_obj, Kind::INT, false, "dependencies")) return nullptr;
+    const Py_ssize_t count = days.size();
+    if (!checkSize(loc, count, "loc_changed") || !checkSize(deps, count, "dependencies")) return nullptr;
+
+    PyObject* result = outputArray(out_obj, 'd', count);
+    if (!result) return nullptr;
+    Buffer out;
+    if (!out.acquire(result, Kind::DOUBLE, true, "out") || !checkSize(out, count, "out")) {
+        Py_DECREF(result);
+        return nullptr;
+    }
+
+    double* out_idi = out.doubles();
+    Py_ssize_t overflow = -1;
+    Py_BEGIN_ALLOW_THREADS
+    for (Py_ssize_t i = 0; i < count; ++i) {
+        long long d = days.integer(i), l = loc.integer(i), dep = deps.integer(i);
+        if (d < INT_MIN || d > INT_MAX || l < INT_MIN || l > INT_MAX || dep < INT_MIN || dep > INT_MAX) {
+            overflow = i;
+            break;
+        }
+        double idi = IDICalculator::calculate(static_cast<int>(d), static_cast<int>(l), static_cast<int>(dep));
+        out_idi[i] = ndigits >= 0 ? roundDigits(idi, ndigits) : idi;
+    }
+    Py_END_ALLOW_THREADS
+
+    if (overflow >= 0) {
+        Py_DECREF(result);
+        PyErr_Format(PyExc_OverflowError, "element %zd does not fit in a C int", overflow);
+        return nullptr;
+    }
+    return result;
+}
+
+PyObject* idiSeverityBatch(PyObject*, PyObject* args, PyObject* kwargs) {
+    static const char* keywords[] = {"idi", "out", nullptr};
+    PyObject *idi_obj, *out_obj = nullptr;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|O:idi_severity_batch",
+                                     const_cast<char**>(keywords), &idi_obj, &out_obj)) {
+        return nullptr;
+    }
+
+    Buffer idi;
+    if (!idi.acquire(idi_obj, Kind::DOUBLE, false, "idi")) return nullptr;
+    const Py_ssize_t count = idi.size();
+
+    PyObject* result = outputArray(out_obj, 'i', count);
+    if (!result) return nullptr;
+    Buffer out;
+    if (!out.acquire(result, Kind::INT, true, "out") || !checkSize(out, count, "out")) {
+        Py_DECREF(result);
+        return nullptr;
+    }
+    if (out.itemsize() != 4) {
+        Py_DECREF(result);
+        PyErr_SetString(PyExc_TypeError, "out: expected a buffer of int32");
+        return nullptr;
+    }
+
+    const double* in = idi.doubles();
+    std::int32_t* severity = out.int32s();
+    const RuntimeThresholds& thresholds = *ThresholdStore::defaultStore().current();
+    Py_BEGIN_ALLOW_THREADS
+    for (Py_ssize_t i = 0; i < count; ++i) {
+        severity[i] = static_cast<std::int32_t>(IDICalculator::getSeverity(in[i], thresholds));
+    }
+    Py_END_ALLOW_THREADS
+    return result;
+}
+
+PyObject* brakeBatch(PyObject*, PyObject* args, PyObject* kwargs) {
+    static const char* keywords[] = {"idi", "out", nullptr};
+    PyObject *idi_obj, *out_obj = nullptr;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|O:brake_batch",
+                                     const_cast<char**>(keywords), &idi_obj, &out_obj)) {
+        return nullptr;
+    }
+
+    Buffer idi;
+    if (!idi.acquire(idi_obj, Kind::DOUBLE, false, "idi")) return nullptr;
+    const Py_ssize_t count = idi.size();
+
+    PyObject* result = outputArray(out_obj, 'd', count);
+    if (!result) return nullptr;
+    Buffer out;
+    if (!out.acquire(result, Kind::DOUBLE, true, "out") || !checkSize(out, count, "out")) {
+        Py_DECREF(result);
+        return nullptr;
+    }
+
+    const double* in = idi.doubles();
+    double* throttle = out.doubles();
+    const RuntimeThresholds& thresholds = *ThresholdStore::defaultStore().current();
+    Py_BEGIN_ALLOW_THREADS
+    for (Py_ssize_t i = 0; i < count; ++i) {
+        throttle[i] = IDIBrake::calculateThrottleLevel(in[i], thresholds);
+    }
+    Py_END_ALLOW_THREADS
+    return result;
+}
+
+// =============================================================================
+// BALANCER
+// =============================================================================
+
+/**
+ * Flat telemetry row layout for Balancer.balance_batch (NaN = absent)
+ */
+enum TelemetryField {
+    F_CPU, F_MEMORY, F_IO_LATENCY, F_NETWORK_LATENCY, F_ERROR_RATE, F_THROUGHPUT,
+    F_TEMPERATURE, F_POWER, TELEMETRY_FIELDS
+};
+
+struct BalancerObject {
+    PyObject_HEAD
+    HardwareSoftwareBalancer* impl;
+};
+
+void setOptional(std::optional<double>& field, PyObject* value) {
+    if (value && value != Py_None) field = PyFloat_AsDouble(value);
+    else field.reset();
+}
+
+PyObject* balancerNew(PyTypeObject* type, PyObject*, PyObject*) {
+    auto* self = reinterpret_cast<BalancerObject*>(type->tp_alloc(type, 0));
+    if (!self) return nullptr;
+    self->impl = new (std::nothrow) HardwareSoftwareBalancer();
+    if (!self->impl) {
+        Py_DECREF(self);
+        return PyErr_NoMemory();
+    }
+    return reinterpret_cast<PyObject*>(self);
+}
+
+int balancerInit(BalancerObject* self, PyObject* args, PyObject* kwargs) {
+    static const char* keywords[] = {"target_throughput", nullptr};
+    double target_throughput = 1000.0;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|d:Balancer",
+                                     const_cast<char**>(keywords), &target_throughput)) {
+        return -1;
+    }
+    auto* impl = new (std::nothrow) HardwareSoftwareBalancer(target_throughput);
+    if (!impl) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    delete self->impl;
+    self->impl = impl;
+    return 0;
+}
+
+void balancerDealloc(BalancerObject* self) {
+    PyTypeObject* type = Py_TYPE(self);
+    delete self->impl;
+    type->tp_free(reinterpret_cast<PyObject*>(self));
+    Py_DECREF(type);
+}
+
+PyObject* balancerHardwareCapacity(BalancerObject* self, PyObject* args, PyObject* kwargs) {
+    static const char* keywords[] = {"cpu_usage", "memory_usage", "temperature", nullptr};
+    TelemetryData telemetry{};
+    PyObject* temperature = nullptr;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "dd|O:hardware_capacity", const_cast<char**>(keywords),
+                                     &telemetry.cpu_usage, &telemetry.memory_usage, &temperature)) {
+        return nullptr;
+    }
+    setOptional(telemetry.temperature, temperature);
+    if (PyErr_Occurred()) return nullptr;
+    return PyFloat_FromDouble(self->impl->calculateHardwareCapacity(telemetry));
+}
+
+PyObject* balancerSoftwareDemand(BalancerObject* self, PyObject* args, PyObject* kwargs) {
+    static const char* keywords[] = {"throughput", "io_latency_ms", "error_rate", nullptr};
+    TelemetryData telemetry{};
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "ddd:software_demand", const_cast<char**>(keywords),
+                                     &telemetry.throughput, &telemetry.io_latency_ms, &telemetry.error_rate)) {
+        return nullptr;
+    }
+    return PyFloat_FromDouble(self->impl->calculateSoftwareDemand(telemetry));
+}
+
+PyObject* balancerBalance(BalancerObject* self, PyObject* args, PyObject* kwargs) {
+    static const char* keywords[] = {
+        "cpu_usage", "memory_usage", "io_latency_ms", "network_latency_ms", "error_rate",
+        "throughput", "temperature", "power_consumption", "current_throttle", nullptr};
+    TelemetryData telemetry{};
+    PyObject *temperature = nullptr, *power = nullptr;
+    double current_throttle = 1.0;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "dddddd|OOd:balance", const_cast<char**>(keywords),
+                                     &telemetry.cpu_usage, &telemetry.memory_usage,
+                                     &telemetry.io_latency_ms, &telemetry.network_latency_ms,
+                                     &telemetry.error_rate, &telemetry.throughput,
+                                     &temperature, &power, &current_throttle)) {
+        return nullptr;
+    }
+    setOptional(telemetry.temperature, temperature);
+    setOptional(telemetry.power_consumption, power);
+    if (PyErr_Occurred()) return nullptr;
+
+    double imbalance = 0.0;
+    BalancingDecision decision = self->impl->balanceDecision(telemetry, current_throttle, &imbalance);
+    return Py_BuildValue("(idd)", static_cast<int>(decision.action), decision.throttle_level, imbalance);
+}
+
+PyObject* balancerBalanceBatch(BalancerObject* self, PyObject* args, PyObject* kwargs) {
+    static const char* keywords[] = {
+        "telemetry", "current_throttle", "out_action", "out_throttle", "out_imbalance", nullptr};
+    PyObject *telemetry_obj, *throttle_obj;
+    PyObject *action_obj = nullptr, *level_obj = nullptr, *imbalance_obj = nullptr;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO|OOO:balance_batch", const_cast<char**>(keywords),
+                                     &telemetry_obj, &throttle_obj, &action_obj, &level_obj, &imbalance_obj)) {
+        return nullptr;
+    }
+
+    Buffer telemetry, throttle;
+    if (!telemetry.acquire(telemetry_obj, Kind::DOUBLE, false, "telemetry")) return nullptr;
+    if (!throttle.acquire(throttle_obj, Kind::DOUBLE, false, "current_throttle")) return nullptr;
+    const Py_ssize_t count = throttle.size();
+    if (!checkSize(telemetry, count * TELEMETRY_FIELDS, "telemetry")) return nullptr;
+
+    PyObject* actions = outputArray(action_obj, 'i', count);
+    PyObject* levels = actions ? outputArray(level_obj, 'd', count) : nullptr;
+    PyObject* imbalances = levels ? outputArray(imbalance_obj, 'd', count) : nullptr;
+    PyObject* result = imbalances ? PyTuple_Pack(3, actions, levels, imbalances) : nullptr;
+    Py_XDECREF(actions);
+    Py_XDECREF(levels);
+    Py_XDECREF(imbalances);
+    if (!result) return nullptr;
+
+    Buffer out_action, out_level, out_imbalance;
+    if (!out_action.acquire(actions, Kind::INT, true, "out_action") || !checkSize(out_action, count, "out_action")
+        || !out_level.acquire(levels, Kind::DOUBLE, true, "out_throttle") || !checkSize(out_level, count, "out_throttle")
+        || !out_imbalance.acquire(imbalances, Kind::DOUBLE, true, "out_imbalance")
+        || !checkSize(out_imbalance, count, "out_imbalance")) {
+        Py_DECREF(result);
+        return nullptr;
+    }
+    if (out_action.itemsize() != 4) {
+        Py_DECREF(result);
+        PyErr_SetString(PyExc_TypeError, "out_action: expected a buffer of int32");
+        return nullptr;
+    }
+
+    const double* rows = telemetry.doubles();
+    const double* current = throttle.doubles();
+    std::int32_t* action = out_action.int32s();
+    double* level = out_level.doubles();
+    double* imbalance = out_imbalance.doubles();
+    bool failed = false;
+
+    Py_BEGIN_ALLOW_THREADS
+    try {
+        TelemetryData sample{};
+        for (Py_ssize_t i = 0; i < count; ++i) {
+            const double* row = rows + i * TELEMETRY_FIELDS;
+            sample.cpu_usage = row[F_CPU];
+            sample.memory_usage = row[F_MEMORY];
+            sample.io_latency_ms = row[F_IO_LATENCY];
+            sample.network_latency_ms = row[F_NETWORK_LATENCY];
+            sample.error_rate = row[F_ERROR_RATE];
+            sample.throughput = row[F_THROUGHPUT];
+            sample.temperature.reset();
+            if (!std::isnan(row[F_TEMPERATURE])) sample.temperature = row[F_TEMPERATURE];
+            sample.power_consumption.reset();
+            if (!std::isnan(row[F_POWER])) sample.power_consumption = row[F_POWER];
+
+            BalancingDecision decision = self->impl->balanceDecision(sample, current[i], &imbalance[i]);
+            action[i] = static_cast<std::int32_t>(decision.action);
+            level[i] = decision.throttle_level;
+        }
+    } catch (...) {
+        failed = true;
+    }
+    Py_END_ALLOW_THREADS
+
+    if (failed) {
+        Py_DECREF(result);
+        PyErr_SetString(PyExc_MemoryError, "balance_batch: allocation failed");
+        return nullptr;
+    }
+    return result;
+}
+
+PyObject* balancerTargetThroughput(BalancerObject* self, void*) {
+    return PyFloat_FromDouble(self->impl->targetThroughput());
+}
+
+PyMethodDef balancer_methods[] = {
+    {"hardware_capacity", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)(void)>(balancerHardwareCapacity)),
+     METH_VARARGS | METH_KEYWORDS, "Hardware capacity score (0-100), unrounded"},
+    {"software_demand", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)(void)>(balancerSoftwareDemand)),
+     METH_VARARGS | METH_KEYWORDS, "Software demand score (0-100), unrounded"},
+    {"balance", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)(void)>(balancerBalance)),
+     METH_VARARGS | METH_KEYWORDS, "One balance step -> (action, throttle_level, smoothed_imbalance)"},
+    {"balance_batch", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)(void)>(balancerBalanceBatch)),
+     METH_VARARGS | METH_KEYWORDS,
+     "balance() over N rows of TELEMETRY_FIELDS doubles -> (actions, throttle_levels, imbalances)"},
+    {nullptr, nullptr, 0, nullptr}
+};
+
+PyGetSetDef balancer_getset[] = {
+    {"target_throughput", reinterpret_cast<getter>(balancerTargetThroughput), nullptr, nullptr, nullptr},
+    {nullptr, nullptr, nullptr, nullptr, nullptr}
+};
+
+PyType_Slot balancer_slots[] = {
+    {Py_tp_doc, const_cast<char*>("HardwareSoftwareBalancer(target_throughput=1000.0)")},
+    {Py_tp_new, reinterpret_cast<void*>(balancerNew)},
+    {Py_tp_init, reinterpret_cast<void*>(balancerInit)},
+    {Py_tp_dealloc, reinterpret_cast<void*>(balancerDealloc)},
+    {Py_tp_methods, balancer_methods},
+    {Py_tp_getset, balancer_getset},
+    {0, nullptr}
+};
+
+PyType_Spec balancer_spec = {
+    "_synapse_native.Balancer",
+    sizeof(BalancerObject),
+    0,
+    Py_TPFLAGS_DEFAULT,
+    balancer_slots
+};
+
+// =============================================================================
+// GIT HISTORY
+// =============================================================================
+
+bool addComponentPaths(git::ComponentPaths& paths, PyObject* name, PyObject* prefixes) {
+    const char* component = PyUnicode_AsUTF8(name);
+    if (!component) return false;
+
+    if (PyUnicode_Check(prefixes)) {
+        const char* prefix = PyUnicode_AsUTF8(prefixes);
+        if (!prefix) return false;
+        paths.add(component, prefix);
+        return true;
+    }
+
+    PyObject* iterator = PyObject_GetIter(prefixes);
+    if (!iterator) return false;
+    paths.component(component);
+    while (PyObject* item = PyIter_Next(iterator)) {
+        const char* prefix = PyUnicode_AsUTF8(item);
+        if (prefix) paths.add(component, prefix);
+        Py_DECREF(item);
+        if (!prefix) break;
+    }
+    Py_DECREF(iterator);
+    return !PyErr_Occurred();
+}
+
+PyObject* historyDict(const git::ComponentHistory& h) {
+    return Py_BuildValue("{s:i,s:L,s:i,s:i,s:O,s:L}",
+                         "days_since_integration", h.days_since_integration,
+                         "loc_changed", static_cast<long long>(h.loc_changed),
+                         "files_touched", h.files_touched,
+                         "commits", h.commits,
+                         "integrated", h.integrated ? Py_True : Py_False,
+                         "last_integration", static_cast<long long>(h.last_integration));
+}
+
+PyObject* gitComponentHistory(PyObject*, PyObject* args, PyObject* kwargs) {
+    static const char* keywords[] = {"paths", "ref", "repo", "now", "cache", nullptr};
+    PyObject* paths_obj;
+    const char* ref = "HEAD";
+    const char* repo = ".";
+    long long now = 0;
+    const char* cache = nullptr;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O!|ssLz:git_component_history",
+                                     const_cast<char**>(keywords),
+                                     &PyDict_Type, &paths_obj, &ref, &repo, &now, &cache)) {
+        return nullptr;
+    }
+
+    git::ComponentPaths paths;
+    PyObject *name, *prefixes;
+    Py_ssize_t pos = 0;
+    while (PyDict_Next(paths_obj, &pos, &name, &prefixes)) {
+        if (!addComponentPaths(paths, name, prefixes)) return nullptr;
+    }
+
+    git::HistoryScan scan(paths, now > 0 ? now : static_cast<long long>(std::time(nullptr)));
+    git::GitLogOptions options{repo, ref, {}};
+    std::string error;
+    Py_BEGIN_ALLOW_THREADS
+    try {
+        if (cache) {
+            git::HistoryCache history(cache, paths);
+            history.update(options.repo, options.ref);
+            history.replay(scan);
+        } else {
+            git::readGitLog(scan, options);
+        }
+    } catch (const std::exception& e) {
+        error = e.what();
+    }
+    Py_END_ALLOW_THREADS
+    if (!error.empty()) {
+        PyErr_SetString(PyExc_RuntimeError, error.c_str());
+        return nullptr;
+    }
+
+    PyObject* result = PyDict_New();
+    if (!result) return nullptr;
+    for (std::uint32_t c = 0; c < paths.size(); ++c) {
+        PyObject* entry = historyDict(scan.result(c));
+        if (!entry || PyDict_SetItemString(result, paths.name(c).c_str(), entry) < 0) {
+            Py_XDECREF(entry);
+            Py_DECREF(result);
+            return nullptr;
+        }
+        Py_DECREF(entry);
+    }
+    return result;
+}
+
+// =============================================================================
+// COMMIT CLASSIFIER
+// =============================================================================
+
+PyObject* classifyCommits(PyObject*, PyObject* args) {
+    PyObject *messages_obj, *allowed_obj;
+    if (!PyArg_ParseTuple(args, "OO:classify_commits", &messages_obj, &allowed_obj)) return nullptr;
+
+    PyObject* allowed_seq = PySequence_Fast(allowed_obj, "allowed_types must be a sequence");
+    if (!allowed_seq) return nullptr;
+    std::vector<std::string> keywords;
+    for (Py_ssize_t i = 0; i < PySequence_Fast_GET_SIZE(allowed_seq); ++i) {
+        const char* keyword = PyUnicode_AsUTF8(PySequence_Fast_GET_ITEM(allowed_seq, i));
+        if (!keyword) {
+            Py_DECREF(allowed_seq);
+            return nullptr;
+        }
+        keywords.emplace_back(keyword);
+    }
+    Py_DECREF(allowed_seq);
+
+    std::optional<commit::CommitClassifier> classifier;
+    try {
+        classifier.emplace(keywords);
+    } catch (const std::exception& e) {
+        PyErr_SetString(PyExc_ValueError, e.what());
+        return nullptr;
+    }
+
+    // A tuple keeps every message alive while the GIL is released
+    PyObject* messages = PySequence_Tuple(messages_obj);
+    if (!messages) return nullptr;
+    const Py_ssize_t count = PyTuple_GET_SIZE(messages);
+
+    std::vector<std::string_view> views(static_cast<size_t>(count));
+    for (Py_ssize_t i = 0; i < count; ++i) {
+        Py_ssize_t size = 0;
+        const char* text = PyUnicode_AsUTF8AndSize(PyTuple_GET_ITEM(messages, i), &size);
+        if (!text) {
+            Py_DECREF(messages);
+            return nullptr;
+        }
+        views[i] = std::string_view(text, static_cast<size_t>(size));
+    }
+
+    std::vector<commit::Classification> out(static_cast<size_t>(count));
+    Py_BEGIN_ALLOW_THREADS
+    classifier->classify(views.data(), views.size(), out.data());
+    Py_END_ALLOW_THREADS
+
+    PyObject* result = PyList_New(count);
+    for (Py_ssize_t i = 0; result && i < count; ++i) {
+        PyObject* item;
+        if (out[i].kind == commit::CommitKind::UNDECIDED) {
+            item = Py_None;
+            Py_INCREF(item);
+        } else {
+            std::string type = classifier->typeName(views[i], out[i]);
+            item = Py_BuildValue("(Os#)", out[i].allowed() ? Py_True : Py_False,
+                                 type.data(), static_cast<Py_ssize_t>(type.size()));
+        }
+        if (!item) {
+            Py_CLEAR(result);
+            break;
+        }
+        PyList_SET_ITEM(result, i, item);
+    }
+    Py_DECREF(messages);
+    return result;
+}
+
+// =============================================================================
+// MODULE
+// =============================================================================
+
+PyMethodDef module_methods[] = {
+    {"idi_calculate", idiCalculate, METH_VARARGS, "IDICalculator::calculate (unrounded)"},
+    {"idi_severity", idiSeverity, METH_VARARGS, "IDICalculator::getSeverity as SeverityLevel ordinal"},
+    {"brake_throttle_level", brakeThrottleLevel, METH_VARARGS, "IDIBrake::calculateThrottleLevel"},
+    {"idi_calculate_batch", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)(void)>(idiCalculateBatch)),
+     METH_VARARGS | METH_KEYWORDS,
+     "IDI per element; ndigits >= 0 rounds like Python round(x, ndigits)"},
+    {"idi_severity_batch", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)(void)>(idiSeverityBatch)),
+     METH_VARARGS | METH_KEYWORDS, "SeverityLevel ordinal per element (int32)"},
+    {"brake_batch", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)(void)>(brakeBatch)),
+     METH_VARARGS | METH_KEYWORDS, "Brake throttle level per element"},
+    {"classify_commits", classifyCommits, METH_VARARGS,
+     "is_allowed_commit() per message as (allowed, type), None where Python must decide"},
+    {"git_component_history", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)(void)>(gitComponentHistory)),
+     METH_VARARGS | METH_KEYWORDS,
+     "IDI inputs per component from one git log pass; paths maps component -> prefix(es), "
+     "cache names an incremental history file (idi_cache.hpp)"},
+    {nullptr, nullptr, 0, nullptr}
+};
+
+PyModuleDef module_def = {
+    PyModuleDef_HEAD_INIT,
+    "_synapse_native",
+    "SYNAPSE C++ engine bindings (balancing_algorithm.hpp)",
+    -1,
+    module_methods,
+    nullptr, nullptr, nullptr, nullptr
+};
+
+} // namespace
+
+PyMODINIT_FUNC PyInit__synapse_native(void) {
+    PyObject* module = PyModule_Create(&module_def);
+    if (!module) return nullptr;
+
+    PyObject* balancer_type = PyType_FromSpec(&balancer_spec);
+    if (!balancer_type
+        || PyModule_AddObject(module, "Balancer", balancer_type) < 0
+        || PyModule_AddIntConstant(module, "TELEMETRY_FIELDS", TELEMETRY_FIELDS) < 0) {
+        Py_XDECREF(balancer_type);
+        Py_DECREF(module);
+        return nullptr;
+    }
+    return module;
+}
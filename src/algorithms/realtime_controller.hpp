@@ -0,0 +1,209 @@
+/**
+ * SYNAPSE Neural Connection Layer - Hard Real-Time Mode
+ * =====================================================
+ *
+ * Decision path for 1 kHz control loops on a hosted OS: HW-SW balancer,
+ * IDI brake, neural pruning and the PID controller with all state
+ * preallocated, and no heap, locks, syscalls or clock reads between
+ * RealtimeController::step() entry and return.
+ *
+ * It is the embedded engine (embedded_balancer.hpp) over double, which
+ * makes the same decisions as HardwareSoftwareBalancer, IDIBrake and
+ * PIDController bit for bit. HardwareSoftwareBalancer keeps its history
+ * deque, mutex, system clock and metrics sink for the non-real-time
+ * paths; none of those can run in a 1 ms budget with a bound.
+ *
+ * Kept off the decision path:
+ *   - prepareRealtimeThread(): mlockall, SCHED_FIFO, stack prefault,
+ *     once before the loop starts
+ *   - toRealtimeTelemetry(): TelemetryData conversion, at ingestion
+ *   - strings: results carry the MitigationAction; format it with
+ *     toString() outside the loop
+ *
+ * Time is the loop's period counter (advance() once per period), so
+ * quarantine durations are in periods: 3'600'000 is one hour at 1 kHz.
+ *
+ * bench/realtime_wcet.cpp measures step() under cache-thrashing
+ * interference and exits non-zero when a configured bound is exceeded.
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#ifndef SYNAPSE_REALTIME_CONTROLLER_HPP
+#define SYNAPSE_REALTIME_CONTROLLER_HPP
+
+#include "balancing_algorithm.hpp"
+#include "embedded_balancer.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#endif
+
+#ifndef SYNAPSE_REALTIME_MAX_COMPONENTS
+#define SYNAPSE_REALTIME_MAX_COMPONENTS 256
+#endif
+
+namespace synapse {
+namespace neural {
+namespace realtime {
+
+using embedded::ComponentId;
+using embedded::INVALID_COMPONENT;
+
+using RealtimeTelemetry = fixed::BasicTelemetry<double>;
+
+/**
+ * Strip a TelemetryData down to the numbers (no id string, no clock)
+ */
+inline RealtimeTelemetry toRealtimeTelemetry(const TelemetryData& telemetry) {
+    RealtimeTelemetry t;
+    t.cpu_usage = telemetry.cpu_usage;
+    t.memory_usage = telemetry.memory_usage;
+    t.io_latency_ms = telemetry.io_latency_ms;
+    t.network_latency_ms = telemetry.network_latency_ms;
+    t.error_rate = telemetry.error_rate;
+    t.throughput = telemetry.throughput;
+    t.has_temperature = telemetry.temperature.has_value();
+    t.temperature = telemetry.temperature.value_or(0.0);
+    return t;
+}
+
+struct RealtimeResult {
+    MitigationAction action;   // Most severe of brake / balance / pruning
+    double throttle_level;     // Combined: min(brake, balance), 0 when quarantined
+    double imbalance;          // Smoothed
+    double pid_adjustment;     // AdaptiveThrottling on cpu_usage (-0.3 to +0.3)
+    bool quarantined;
+};
+
+// =============================================================================
+// CONTROLLER
+// =============================================================================
+
+/**
+ * Fixed-capacity controller for one real-time loop
+ *
+ * Single thread: call step() / advance() from the loop only. The object
+ * owns no heap memory, so placing it (static, or on a locked stack)
+ * is all the preallocation there is.
+ */
+template <std::size_t MaxComponents = SYNAPSE_REALTIME_MAX_COMPONENTS,
+          std::size_t Window = SYNAPSE_EMBEDDED_HISTORY_WINDOW>
+class RealtimeController {
+public:
+    using Engine = embedded::EmbeddedEngine<double, MaxComponents, Window>;
+
+    static_assert(std::is_trivially_destructible_v<Engine>,
+                  "real-time state must not own resources");
+
+private:
+    Engine engine_;
+    std::uint32_t period_ = 0;
+
+public:
+    /**
+     * @param min_quarantine_periods Minimum time in quarantine, in loop periods
+     * @param thresholds Copied at construction; defaults to the live
+     *        ThresholdStore snapshot, later updates need a new controller
+     */
+    explicit RealtimeController(std::uint32_t min_quarantine_periods = 3600000,
+                                double target_throughput = 1000.0,
+                                const RuntimeThresholds& thresholds = *ThresholdStore::defaultStore().current())
+        : engine_(min_quarantine_periods, target_throughput,
+                  fixed::BasicThresholds<double>(thresholds)) {}
+
+    /**
+     * Register a component (setup time)
+     *
+     * @return Its ID, or INVALID_COMPONENT when the table is full
+     */
+    ComponentId add() { return engine_.add(); }
+
+    /**
+     * Slow-moving inputs (IDI from the integration pipeline, health score)
+     */
+    void setIntegrationState(ComponentId id, double idi, double health_score) noexcept {
+        engine_.setIntegrationState(id, idi, health_score);
+    }
+
+    /**
+     * One control step for one component; bounded, allocation- and lock-free
+     */
+    RealtimeResult step(ComponentId id, const RealtimeTelemetry& telemetry) noexcept {
+        embedded::EngineResult<double> r = engine_.tick(id, telemetry, period_);
+#if !defined(SYNAPSE_EMBEDDED_NO_PID)
+        double adjustment = engine_.pidAdjust(id, telemetry.cpu_usage);
+#else
+        double adjustment = 0.0;
+#endif
+        return {r.action, r.throttle_level, r.imbalance, adjustment, r.quarantined};
+    }
+
+    /**
+     * End of a loop period
+     */
+    void advance() noexcept { ++period_; }
+
+    std::uint32_t period() const { return period_; }
+    std::size_t size() const { return engine_.size(); }
+    static constexpr std::size_t capacity() { return MaxComponents; }
+
+    double throttleLevel(ComponentId id) const { return engine_.throttleLevel(id); }
+};
+
+// =============================================================================
+// THREAD SETUP
+// =============================================================================
+
+struct RealtimeThreadStatus {
+    bool memory_locked = false;   // mlockall(MCL_CURRENT | MCL_FUTURE) succeeded
+    bool fifo_scheduling = false; // SCHED_FIFO at the requested priority
+};
+
+/**
+ * Prepare the calling thread for the loop: lock all pages, switch to
+ * SCHED_FIFO (fifo_priority > 0) and touch `stack_bytes` of stack (at
+ * most 256 KiB) so the first periods take no page faults
+ *
+ * Both calls need privileges (CAP_IPC_LOCK / CAP_SYS_NICE or rlimits);
+ * a failure is reported, not fatal. Linux only; elsewhere nothing is
+ * done and both flags are false.
+ */
+inline RealtimeThreadStatus prepareRealtimeThread(int fifo_priority = 0,
+                                                  std::size_t stack_bytes = 64 * 1024) {
+    RealtimeThreadStatus status;
+#if defined(__linux__)
+    status.memory_locked = mlockall(MCL_CURRENT | MCL_FUTURE) == 0;
+
+    if (fifo_priority > 0) {
+        sched_param param{};
+        param.sched_priority = fifo_priority;
+        status.fifo_scheduling = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0;
+    }
+
+    // Fault in the stack the loop will use (volatile: must not be elided)
+    constexpr std::size_t PAGE = 4096;
+    constexpr std::size_t MAX_PREFAULT = 256 * 1024;
+    unsigned char stack[MAX_PREFAULT];
+    volatile unsigned char* top = stack + MAX_PREFAULT - 1;
+    std::size_t bytes = stack_bytes < MAX_PREFAULT ? stack_bytes : MAX_PREFAULT;
+    for (std::size_t i = 0; i < bytes; i += PAGE) top[-static_cast<std::ptrdiff_t>(i)] = 0;
+#else
+    (void)fifo_priority;
+    (void)stack_bytes;
+#endif
+    return status;
+}
+
+} // namespace realtime
+} // namespace neural
+} // namespace synapse
+
+#endif // SYNAPSE_REALTIME_CONTROLLER_HPP
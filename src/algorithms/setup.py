@@ -0,0 +1,31 @@
+"""
+SYNAPSE Native Engine - CPython extension build
+===============================================
+
+Builds _synapse_native next to the Python modules that use it:
+
+    python setup.py build_ext --inplace
+
+neural_mitigation.py, idi_lock.py and project_simulator.py import it
+when present and keep their pure-Python formulas otherwise.
+"""
+
+from setuptools import Extension, setup
+
+setup(
+    name="synapse-native",
+    version="0.1.0",
+    description="SYNAPSE C++ engine bindings",
+    ext_modules=[
+        Extension(
+            "_synapse_native",
+            sources=["python/_synapse_native.cpp"],
+            depends=["balancing_algorithm.hpp", "balancing_types.hpp",
+                     "balancing_hysteresis.hpp", "commit_classifier.hpp",
+                     "git_history.hpp", "idi_cache.hpp"],
+            include_dirs=["."],
+            language="c++",
+            extra_compile_args=["-std=c++17", "-O2"],
+        )
+    ],
+)
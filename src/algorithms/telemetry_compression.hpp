@@ -0,0 +1,428 @@
+/**
+ * SYNAPSE Neural Connection Layer - Compressed Telemetry History
+ * ==============================================================
+ *
+ * Gorilla-style compression for per-component telemetry history:
+ * delta-of-delta timestamps and XOR-encoded doubles in a single bit
+ * stream per block, decoded sequentially.
+ *
+ * Stable components compress to a few bytes per sample instead of the
+ * ~120 bytes of an uncompressed TelemetryData.
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#ifndef SYNAPSE_TELEMETRY_COMPRESSION_HPP
+#define SYNAPSE_TELEMETRY_COMPRESSION_HPP
+
+#include "balancing_algorithm.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace synapse {
+namespace neural {
+namespace compression {
+
+// =============================================================================
+// BIT STREAM
+// =============================================================================
+
+/**
+ * MSB-first bit writer over 64-bit words
+ */
+class BitWriter {
+private:
+    std::vector<std::uint64_t> words_;
+    size_t bits_ = 0;
+
+public:
+    /**
+     * Append the low `count` bits of value (count <= 64)
+     */
+    void write(std::uint64_t value, unsigned count) {
+        if (count == 0) return;
+        if (count < 64) value &= (std::uint64_t{1} << count) - 1;
+
+        const unsigned offset = static_cast<unsigned>(bits_ & 63);
+        if (offset == 0) words_.push_back(0);
+
+        const unsigned free_bits = 64 - offset;
+        if (count <= free_bits) {
+            words_.back() |= value << (free_bits - count);
+        } else {
+            const unsigned spill = count - free_bits;
+            words_.back() |= value >> spill;
+            words_.push_back(value << (64 - spill));
+        }
+        bits_ += count;
+    }
+
+    void writeBit(bool bit) { write(bit ? 1 : 0, 1); }
+
+    size_t bits() const { return bits_; }
+    const std::vector<std::uint64_t>& words() const { return words_; }
+
+    void shrink() { words_.shrink_to_fit(); }
+};
+
+/**
+ * Sequential reader for BitWriter output
+ */
+class BitReader {
+private:
+    const std::uint64_t* words_;
+    size_t pos_ = 0;
+
+public:
+    explicit BitReader(const std::uint64_t* words) : words_(words) {}
+
+    std::uint64_t read(unsigned count) {
+        if (count == 0) return 0;
+
+        const size_t word = pos_ >> 6;
+        const unsigned offset = static_cast<unsigned>(pos_ & 63);
+        const unsigned available = 64 - offset;
+        pos_ += count;
+
+        if (count <= available) {
+            return (words_[word] << offset) >> (64 - count);
+        }
+
+        const unsigned rest = count - available;
+        const std::uint64_t high = words_[word] & ((std::uint64_t{1} << available) - 1);
+        return (high << rest) | (words_[word + 1] >> (64 - rest));
+    }
+
+    bool readBit() { return read(1) != 0; }
+};
+
+// =============================================================================
+// GORILLA CODECS
+// =============================================================================
+
+/**
+ * Delta-of-delta timestamp codec (millisecond resolution)
+ *
+ * Bucket layout: '0' | '10'+7 | '110'+9 | '1110'+12 | '1111'+64 bits.
+ */
+struct TimestampCodec {
+    std::int64_t previous = 0;
+    std::int64_t previous_delta = 0;
+    bool started = false;
+
+    void encode(BitWriter& out, std::int64_t millis) {
+        if (!started) {
+            out.write(static_cast<std::uint64_t>(millis), 64);
+            previous = millis;
+            started = true;
+            return;
+        }
+
+        const std::int64_t delta = millis - previous;
+        const std::int64_t dod = delta - previous_delta;
+        previous = millis;
+        previous_delta = delta;
+
+        if (dod == 0) {
+            out.write(0b0, 1);
+        } else if (dod >= -63 && dod <= 64) {
+            out.write(0b10, 2);
+            out.write(static_cast<std::uint64_t>(dod + 63), 7);
+        } else if (dod >= -255 && dod <= 256) {
+            out.write(0b110, 3);
+            out.write(static_cast<std::uint64_t>(dod + 255), 9);
+        } else if (dod >= -2047 && dod <= 2048) {
+            out.write(0b1110, 4);
+            out.write(static_cast<std::uint64_t>(dod + 2047), 12);
+        } else {
+            out.write(0b1111, 4);
+            out.write(static_cast<std::uint64_t>(dod), 64);
+        }
+    }
+
+    std::int64_t decode(BitReader& in) {
+        if (!started) {
+            previous = static_cast<std::int64_t>(in.read(64));
+            started = true;
+            return previous;
+        }
+
+        std::int64_t dod;
+        if (!in.readBit()) {
+            dod = 0;
+        } else if (!in.readBit()) {
+            dod = static_cast<std::int64_t>(in.read(7)) - 63;
+        } else if (!in.readBit()) {
+            dod = static_cast<std::int64_t>(in.read(9)) - 255;
+        } else if (!in.readBit()) {
+            dod = static_cast<std::int64_t>(in.read(12)) - 2047;
+        } else {
+            dod = static_cast<std::int64_t>(in.read(64));
+        }
+
+        previous_delta += dod;
+        previous += previous_delta;
+        return previous;
+    }
+};
+
+/**
+ * XOR codec for one double channel
+ *
+ * '0' = same value; '10' + bits = reuse previous leading/trailing window;
+ * '11' + 5 bits leading + 6 bits length + bits = new window.
+ */
+struct ValueCodec {
+    std::uint64_t previous = 0;
+    unsigned leading = 0;
+    unsigned trailing = 0;
+    bool has_window = false;
+
+    static std::uint64_t toBits(double value) {
+        std::uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    static double fromBits(std::uint64_t bits) {
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    void encode(BitWriter& out, double value) {
+        const std::uint64_t bits = toBits(value);
+        const std::uint64_t x = bits ^ previous;
+        previous = bits;
+
+        if (x == 0) {
+            out.write(0b0, 1);
+            return;
+        }
+
+        unsigned lead = static_cast<unsigned>(__builtin_clzll(x));
+        const unsigned trail = static_cast<unsigned>(__builtin_ctzll(x));
+        if (lead > 31) lead = 31;
+
+        if (has_window && lead >= leading && trail >= trailing) {
+            out.write(0b10, 2);
+            out.write(x >> trailing, 64 - leading - trailing);
+            return;
+        }
+
+        const unsigned length = 64 - lead - trail;
+        out.write(0b11, 2);
+        out.write(lead, 5);
+        out.write(length == 64 ? 0 : length, 6);
+        out.write(x >> trail, length);
+
+        leading = lead;
+        trailing = trail;
+        has_window = true;
+    }
+
+    double decode(BitReader& in) {
+        if (in.readBit()) {
+            if (in.readBit()) {
+                leading = static_cast<unsigned>(in.read(5));
+                unsigned length = static_cast<unsigned>(in.read(6));
+                if (length == 0) length = 64;
+                trailing = 64 - leading - length;
+            }
+            previous ^= in.read(64 - leading - trailing) << trailing;
+        }
+        return fromBits(previous);
+    }
+};
+
+// =============================================================================
+// TELEMETRY BLOCK
+// =============================================================================
+
+/**
+ * Independently decodable run of telemetry samples
+ *
+ * Per sample: timestamp, six always-present doubles, then a presence
+ * bit (+ value) for temperature and power consumption.
+ */
+class TelemetryBlock {
+private:
+    static constexpr size_t CHANNELS = 8;
+
+    BitWriter bits_;
+    TimestampCodec timestamps_;
+    ValueCodec values_[CHANNELS];
+    size_t samples_ = 0;
+
+    static std::int64_t toMillis(std::chrono::system_clock::time_point tp) {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(tp.time_since_epoch()).count();
+    }
+
+public:
+    void append(const TelemetryData& t) {
+        timestamps_.encode(bits_, toMillis(t.timestamp));
+        values_[0].encode(bits_, t.cpu_usage);
+        values_[1].encode(bits_, t.memory_usage);
+        values_[2].encode(bits_, t.io_latency_ms);
+        values_[3].encode(bits_, t.network_latency_ms);
+        values_[4].encode(bits_, t.error_rate);
+        values_[5].encode(bits_, t.throughput);
+
+        bits_.writeBit(t.temperature.has_value());
+        if (t.temperature) values_[6].encode(bits_, *t.temperature);
+        bits_.writeBit(t.power_consumption.has_value());
+        if (t.power_consumption) values_[7].encode(bits_, *t.power_consumption);
+
+        ++samples_;
+    }
+
+    /**
+     * Decode every sample in order into a reused TelemetryData
+     *
+     * Only the numeric fields and timestamp are written; component_id is
+     * left as the caller set it.
+     */
+    template <typename Fn>
+    void forEach(TelemetryData& scratch, Fn&& fn) const {
+        BitReader in(bits_.words().data());
+        TimestampCodec timestamps;
+        ValueCodec values[CHANNELS];
+
+        for (size_t i = 0; i < samples_; ++i) {
+            scratch.timestamp = std::chrono::system_clock::time_point(
+                std::chrono::milliseconds(timestamps.decode(in)));
+            scratch.cpu_usage = values[0].decode(in);
+            scratch.memory_usage = values[1].decode(in);
+            scratch.io_latency_ms = values[2].decode(in);
+            scratch.network_latency_ms = values[3].decode(in);
+            scratch.error_rate = values[4].decode(in);
+            scratch.throughput = values[5].decode(in);
+
+            scratch.temperature.reset();
+            if (in.readBit()) scratch.temperature = values[6].decode(in);
+            scratch.power_consumption.reset();
+            if (in.readBit()) scratch.power_consumption = values[7].decode(in);
+
+            fn(static_cast<const TelemetryData&>(scratch));
+        }
+    }
+
+    size_t size() const { return samples_; }
+    size_t bytes() const { return bits_.words().capacity() * sizeof(std::uint64_t); }
+
+    void seal() { bits_.shrink(); }
+};
+
+// =============================================================================
+// COMPRESSED HISTORY
+// =============================================================================
+
+/**
+ * Compressed replacement for a per-component deque of TelemetryData
+ *
+ * Samples are appended to an open block; full blocks are sealed and the
+ * oldest block is dropped once more than `capacity` samples are held, so
+ * at least `capacity` samples are always retained. Timestamps are stored
+ * with millisecond resolution; all other values round-trip exactly.
+ */
+class CompressedTelemetryHistory {
+private:
+    std::string component_id_;
+    size_t capacity_;
+    size_t block_size_;
+    size_t samples_ = 0;
+
+    std::deque<TelemetryBlock> blocks_;
+    TelemetryData latest_{};
+
+public:
+    explicit CompressedTelemetryHistory(std::string component_id,
+                                        size_t capacity = 1000,
+                                        size_t block_size = 128)
+        : component_id_(std::move(component_id)),
+          capacity_(capacity),
+          block_size_(std::max<size_t>(block_size, 1)) {
+        latest_.component_id = component_id_;
+    }
+
+    void push(const TelemetryData& telemetry) {
+        if (blocks_.empty() || blocks_.back().size() >= block_size_) {
+            if (!blocks_.empty()) blocks_.back().seal();
+            blocks_.emplace_back();
+        }
+
+        blocks_.back().append(telemetry);
+        ++samples_;
+
+        while (blocks_.size() > 1 && samples_ - blocks_.front().size() >= capacity_) {
+            samples_ -= blocks_.front().size();
+            blocks_.pop_front();
+        }
+
+        latest_.timestamp = telemetry.timestamp;
+        latest_.cpu_usage = telemetry.cpu_usage;
+        latest_.memory_usage = telemetry.memory_usage;
+        latest_.io_latency_ms = telemetry.io_latency_ms;
+        latest_.network_latency_ms = telemetry.network_latency_ms;
+        latest_.error_rate = telemetry.error_rate;
+        latest_.throughput = telemetry.throughput;
+        latest_.temperature = telemetry.temperature;
+        latest_.power_consumption = telemetry.power_consumption;
+    }
+
+    /**
+     * Most recent sample without decoding (for anomaly checks)
+     */
+    const TelemetryData& latest() const { return latest_; }
+
+    /**
+     * Decode all retained samples oldest-first
+     */
+    template <typename Fn>
+    void forEach(Fn&& fn) const {
+        TelemetryData scratch;
+        scratch.component_id = component_id_;
+        for (const auto& block : blocks_) {
+            block.forEach(scratch, fn);
+        }
+    }
+
+    /**
+     * Feed the retained history through a balancer, oldest first
+     *
+     * @return Result for the newest sample
+     */
+    MitigationResult replayInto(HardwareSoftwareBalancer& balancer, double current_throttle) const {
+        MitigationResult last;
+        last.action = MitigationAction::NONE;
+        last.component_id = component_id_;
+        last.throttle_level = current_throttle;
+
+        forEach([&](const TelemetryData& telemetry) {
+            last = balancer.balance(telemetry, last.throttle_level);
+        });
+        return last;
+    }
+
+    const std::string& componentId() const { return component_id_; }
+    size_t size() const { return samples_; }
+    bool empty() const { return samples_ == 0; }
+
+    size_t bytes() const {
+        size_t total = sizeof(*this);
+        for (const auto& block : blocks_) total += sizeof(block) + block.bytes();
+        return total;
+    }
+};
+
+} // namespace compression
+} // namespace neural
+} // namespace synapse
+
+#endif // SYNAPSE_TELEMETRY_COMPRESSION_HPP
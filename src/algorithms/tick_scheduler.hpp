@@ -0,0 +1,347 @@
+/**
+ * SYNAPSE Neural Connection Layer - Multi-Rate Tick Scheduler
+ * ===========================================================
+ *
+ * Components report at very different rates (motor controllers at 1 kHz,
+ * cloud services every 30 s). The scheduler groups them by rate and runs
+ * each group's batch kernel on its own period and deadline:
+ *
+ *   TickScheduler<> scheduler;
+ *   auto fast = scheduler.addGroup({"motors", 1ms}, motor_kernel);
+ *   auto slow = scheduler.addGroup({"cloud", 30s, 0ns, 256}, cloud_kernel);
+ *   scheduler.addComponent(fast, handle);
+ *   ...
+ *   scheduler.run(stop);
+ *
+ * Dispatch is deadline-monotonic over released jobs, one chunk at a time,
+ * on the calling thread: the group with the shorter relative deadline
+ * always goes first. (Earliest-deadline-first would let a slow job that is
+ * already overdue outrank every fast one under overload.) A group with a
+ * chunk size hands its kernel at most that many components per call, and
+ * the clock is re-read between chunks. A fast group released in the middle
+ * of a large slow batch therefore waits for at most one chunk, never for
+ * the whole batch.
+ *
+ * A job that is still running when its group's next period comes keeps
+ * running. The release is skipped and counted as a missed deadline: there
+ * is no catch-up burst. Each completion records its lateness (completion
+ * - deadline) in the group's histogram.
+ *
+ * Not thread-safe: add groups and components between runDue() calls, on
+ * the scheduling thread.
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#ifndef SYNAPSE_TICK_SCHEDULER_HPP
+#define SYNAPSE_TICK_SCHEDULER_HPP
+
+#include "balancing_algorithm.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace synapse {
+namespace neural {
+
+// =============================================================================
+// CONFIGURATION
+// =============================================================================
+
+struct RateGroupConfig {
+    std::string name;
+    std::chrono::nanoseconds period;
+
+    // Relative deadline; zero = the period
+    std::chrono::nanoseconds deadline = std::chrono::nanoseconds::zero();
+
+    // Components per kernel call; zero = the whole batch in one call
+    size_t chunk = 0;
+};
+
+/**
+ * Batch kernel: processes handles[0, count) of its group
+ */
+using BatchKernel = std::function<void(const ComponentHandle* handles, size_t count)>;
+
+// =============================================================================
+// LATENESS HISTOGRAM
+// =============================================================================
+
+/**
+ * Completion time relative to the deadline, in log2 microsecond buckets
+ *
+ * Bucket 0 counts on-time jobs. Bucket k (1..BUCKETS-2) counts jobs late
+ * by up to 2^(k-1) us: <= 1 us, <= 2 us, <= 4 us, ... The last bucket
+ * takes everything later (> 2^27 us, about 134 s).
+ */
+struct LatenessHistogram {
+    static constexpr size_t BUCKETS = 30;
+
+    std::array<std::uint64_t, BUCKETS> counts{};
+    std::chrono::nanoseconds max_lateness = std::chrono::nanoseconds::min();
+
+    void add(std::chrono::nanoseconds lateness) {
+        max_lateness = std::max(max_lateness, lateness);
+        ++counts[bucketOf(lateness)];
+    }
+
+    static size_t bucketOf(std::chrono::nanoseconds lateness) {
+        if (lateness <= std::chrono::nanoseconds::zero()) return 0;
+        auto us = static_cast<std::uint64_t>((lateness.count() + 999) / 1000);
+        size_t bucket = 1;
+        while (bucket < BUCKETS - 1 && (std::uint64_t(1) << (bucket - 1)) < us) ++bucket;
+        return bucket;
+    }
+
+    /**
+     * Upper bound of a bucket in microseconds (0 for on time, -1 for the last)
+     */
+    static std::int64_t upperBoundMicros(size_t bucket) {
+        if (bucket == 0) return 0;
+        if (bucket >= BUCKETS - 1) return -1;
+        return std::int64_t(1) << (bucket - 1);
+    }
+
+    std::uint64_t total() const {
+        std::uint64_t sum = 0;
+        for (std::uint64_t c : counts) sum += c;
+        return sum;
+    }
+};
+
+struct RateGroupStats {
+    std::uint64_t releases = 0;          // Jobs started
+    std::uint64_t completions = 0;
+    std::uint64_t missed_deadlines = 0;  // Late completions plus skipped releases
+    std::uint64_t skipped_releases = 0;  // Periods that got no job of their own
+    std::uint64_t kernel_calls = 0;
+    std::chrono::nanoseconds max_response = std::chrono::nanoseconds::zero();   // Release to completion
+    LatenessHistogram lateness;
+};
+
+// =============================================================================
+// TICK SCHEDULER
+// =============================================================================
+
+/**
+ * Deadline-monotonic scheduler over rate groups
+ *
+ * Clock must be a steady std::chrono clock; a fake clock with a static
+ * now() makes schedules reproducible in tests and replays.
+ */
+template <typename Clock = std::chrono::steady_clock>
+class TickScheduler {
+public:
+    using time_point = typename Clock::time_point;
+    using GroupId = size_t;
+
+private:
+    struct Group {
+        RateGroupConfig config;
+        BatchKernel kernel;
+        std::vector<ComponentHandle> members;
+
+        time_point next_release;
+        bool started = false;    // First release scheduled
+        bool held = false;       // Completed a job in this runDue() pass
+
+        // Current job
+        bool active = false;
+        size_t position = 0;
+        time_point release;
+        time_point deadline;
+
+        RateGroupStats stats;
+    };
+
+    std::vector<Group> groups_;
+
+    /**
+     * Start jobs for every group whose release time has come
+     */
+    void release(time_point now) {
+        for (Group& g : groups_) {
+            if (!g.started) {
+                g.next_release = now;
+                g.started = true;
+            }
+            if (g.held || now < g.next_release) continue;
+
+            // Periods that passed since the scheduled release, this one included
+            auto periods = static_cast<std::uint64_t>((now - g.next_release) / g.config.period) + 1;
+
+            std::uint64_t skipped = periods;
+            if (!g.active) {
+                // Start the latest period's job; earlier ones are skipped
+                g.active = true;
+                g.position = 0;
+                g.release = g.next_release + (periods - 1) * g.config.period;
+                g.deadline = g.release + g.config.deadline;
+                ++g.stats.releases;
+                --skipped;
+            }
+            g.stats.skipped_releases += skipped;
+            g.stats.missed_deadlines += skipped;
+            g.next_release += periods * g.config.period;
+        }
+    }
+
+    /**
+     * Active group with the shortest relative deadline (ties: earlier
+     * absolute deadline, then lower id), or npos
+     */
+    size_t pick() const {
+        size_t best = npos;
+        for (size_t i = 0; i < groups_.size(); ++i) {
+            const Group& g = groups_[i];
+            if (!g.active) continue;
+            if (best == npos) {
+                best = i;
+                continue;
+            }
+            const Group& b = groups_[best];
+            if (g.config.deadline < b.config.deadline
+                || (g.config.deadline == b.config.deadline && g.deadline < b.deadline)) {
+                best = i;
+            }
+        }
+        return best;
+    }
+
+    void complete(Group& g, time_point now) {
+        g.active = false;
+        ++g.stats.completions;
+
+        auto lateness = std::chrono::duration_cast<std::chrono::nanoseconds>(now - g.deadline);
+        auto response = std::chrono::duration_cast<std::chrono::nanoseconds>(now - g.release);
+        if (lateness > std::chrono::nanoseconds::zero()) ++g.stats.missed_deadlines;
+        g.stats.max_response = std::max(g.stats.max_response, response);
+        g.stats.lateness.add(lateness);
+    }
+
+public:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    /**
+     * Add a rate group; its first job is released on the next runDue()
+     */
+    GroupId addGroup(RateGroupConfig config, BatchKernel kernel) {
+        if (config.period <= std::chrono::nanoseconds::zero()) {
+            config.period = std::chrono::nanoseconds(1);
+        }
+        if (config.deadline <= std::chrono::nanoseconds::zero()) config.deadline = config.period;
+
+        Group group;
+        group.config = std::move(config);
+        group.kernel = std::move(kernel);
+        groups_.push_back(std::move(group));
+        return groups_.size() - 1;
+    }
+
+    void addComponent(GroupId group, ComponentHandle handle) {
+        groups_[group].members.push_back(handle);
+    }
+
+    /**
+     * Remove a component (swap-remove; the member order changes)
+     *
+     * @return false if it was not in the group
+     */
+    bool removeComponent(GroupId group, ComponentHandle handle) {
+        auto& members = groups_[group].members;
+        auto it = std::find(members.begin(), members.end(), handle);
+        if (it == members.end()) return false;
+        *it = members.back();
+        members.pop_back();
+        return true;
+    }
+
+    /**
+     * Run every job that is due, highest priority first, until none is
+     *
+     * Releases are re-checked after every kernel call, so a faster group
+     * released meanwhile runs before the rest of a slower batch. A group
+     * completes at most one job per call: one whose kernel takes its whole
+     * period is released again on the next call, so the call always ends.
+     *
+     * @param stop Checked between kernel calls; when set, returns early
+     *             leaving the current jobs active
+     * @return When the next job is released
+     */
+    time_point runDue(const std::atomic<bool>* stop = nullptr) {
+        for (Group& g : groups_) g.held = false;
+        time_point now = Clock::now();
+        release(now);
+
+        for (size_t id = pick(); id != npos; id = pick()) {
+            if (stop && stop->load(std::memory_order_relaxed)) break;
+
+            Group& g = groups_[id];
+            size_t remaining = g.members.size() - std::min(g.position, g.members.size());
+            size_t count = g.config.chunk ? std::min(g.config.chunk, remaining) : remaining;
+
+            if (count > 0) {
+                g.kernel(g.members.data() + g.position, count);
+                ++g.stats.kernel_calls;
+                g.position += count;
+            }
+
+            now = Clock::now();
+            if (g.position >= g.members.size()) {
+                complete(g, now);
+                g.held = true;
+            }
+            release(now);
+        }
+
+        return nextRelease();
+    }
+
+    /**
+     * Earliest upcoming release (now if a group has not started yet)
+     */
+    time_point nextRelease() const {
+        time_point next = time_point::max();
+        for (const Group& g : groups_) {
+            next = std::min(next, g.started ? g.next_release : Clock::now());
+        }
+        return next;
+    }
+
+    /**
+     * Dispatch loop: runDue(), then sleep until the next release
+     */
+    void run(const std::atomic<bool>& stop) {
+        while (!stop.load(std::memory_order_relaxed)) {
+            time_point next = runDue(&stop);
+            if (next == time_point::max()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            } else {
+                std::this_thread::sleep_until(next);
+            }
+        }
+    }
+
+    size_t groupCount() const { return groups_.size(); }
+    const RateGroupConfig& config(GroupId group) const { return groups_[group].config; }
+    const RateGroupStats& stats(GroupId group) const { return groups_[group].stats; }
+    size_t memberCount(GroupId group) const { return groups_[group].members.size(); }
+
+    void resetStats() {
+        for (Group& g : groups_) g.stats = RateGroupStats{};
+    }
+};
+
+} // namespace neural
+} // namespace synapse
+
+#endif // SYNAPSE_TICK_SCHEDULER_HPP
@@ -0,0 +1,151 @@
+/**
+ * SYNAPSE Replay Tool
+ * ===================
+ *
+ * Replays a balancer recording (see balance_replay.hpp) against this
+ * build and reports mismatching decisions and replay throughput.
+ *
+ * Build:
+ *   g++ -std=c++17 -O2 -I.. synapse_replay.cpp -o synapse_replay
+ *
+ * Usage:
+ *   synapse_replay <recording> [--decisions <out>]   Replay, optionally save decisions
+ *   synapse_replay --diff <decisions-a> <decisions-b> Compare two builds' decisions
+ *
+ * Exit Codes:
+ *   0 = Decisions identical
+ *   1 = Decisions differ
+ *   2 = Usage or I/O error
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#include "balance_replay.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+using namespace synapse::neural;
+using namespace synapse::neural::replay;
+
+namespace {
+
+constexpr std::uint64_t MAX_REPORTED = 20;
+
+void printDecision(const char* label, const Decision& d) {
+    std::printf("    %-9s action=%-14s throttle=%.17g imbalance=%.17g\n",
+                label, toString(d.action), d.throttle_level, d.imbalance);
+}
+
+int replayRecording(const char* path, const char* decisions_path) {
+    std::ifstream in(path, std::ios::binary);
+    BalanceReplayer replayer(in);
+    if (!replayer.valid()) {
+        if (replayer.version() != 0 && replayer.version() != FORMAT_VERSION) {
+            std::fprintf(stderr, "Error: %s has format version %u, this build reads %u\n",
+                         path, replayer.version(), FORMAT_VERSION);
+        } else {
+            std::fprintf(stderr, "Error: %s is not a SYNAPSE recording\n", path);
+        }
+        return 2;
+    }
+
+    std::ofstream decisions_file;
+    std::unique_ptr<BinaryWriter> decisions;
+    if (decisions_path) {
+        decisions_file.open(decisions_path, std::ios::binary);
+        if (!decisions_file) {
+            std::fprintf(stderr, "Error: cannot write %s\n", decisions_path);
+            return 2;
+        }
+        decisions = std::make_unique<BinaryWriter>(decisions_file);
+    }
+
+    std::uint64_t reported = 0;
+    ReplayStats stats = replayer.run([&](std::uint64_t tick, const Decision& recorded,
+                                         const Decision& replayed) {
+        if (decisions) decisions->decision(replayed);
+        if (recorded != replayed && reported++ < MAX_REPORTED) {
+            std::printf("  tick %llu differs:\n", static_cast<unsigned long long>(tick));
+            printDecision("recorded", recorded);
+            printDecision("replayed", replayed);
+        }
+    });
+
+    std::printf("Ticks:           %llu\n", static_cast<unsigned long long>(stats.ticks));
+    std::printf("Mismatches:      %llu\n", static_cast<unsigned long long>(stats.mismatches));
+    std::printf("Hysteresis:      %s\n", stats.hysteresis ? "on" : "off");
+    std::printf("Clock underruns: %llu\n", static_cast<unsigned long long>(stats.clock_underruns));
+    std::printf("Clock overruns:  %llu\n", static_cast<unsigned long long>(stats.clock_overruns));
+    std::printf("Replay time:     %.3f s (%.0f ticks/s)\n", stats.seconds,
+                stats.seconds > 0 ? stats.ticks / stats.seconds : 0.0);
+    if (stats.truncated) std::printf("Warning: recording ends with a truncated record\n");
+
+    return stats.mismatches == 0 ? 0 : 1;
+}
+
+int diffDecisions(const char* path_a, const char* path_b) {
+    std::ifstream file_a(path_a, std::ios::binary);
+    std::ifstream file_b(path_b, std::ios::binary);
+    if (!file_a || !file_b) {
+        std::fprintf(stderr, "Error: cannot open decision files\n");
+        return 2;
+    }
+
+    BinaryReader a(file_a), b(file_b);
+    std::uint64_t tick = 0, differences = 0;
+    std::uint8_t tag_a = 0, tag_b = 0;
+
+    while (true) {
+        bool more_a = a.pod(tag_a), more_b = b.pod(tag_b);
+        if (!more_a || !more_b) {
+            if (more_a != more_b) {
+                std::printf("Decision streams differ in length after %llu ticks\n",
+                            static_cast<unsigned long long>(tick));
+                ++differences;
+            }
+            break;
+        }
+
+        Decision da, db;
+        if (tag_a != TAG_DECISION || tag_b != TAG_DECISION || !a.decision(da) || !b.decision(db)) {
+            std::fprintf(stderr, "Error: malformed decision file\n");
+            return 2;
+        }
+
+        if (da != db && differences++ < MAX_REPORTED) {
+            std::printf("  tick %llu differs:\n", static_cast<unsigned long long>(tick));
+            printDecision("a", da);
+            printDecision("b", db);
+        }
+        ++tick;
+    }
+
+    std::printf("Ticks compared: %llu, differences: %llu\n",
+                static_cast<unsigned long long>(tick), static_cast<unsigned long long>(differences));
+    return differences == 0 ? 0 : 1;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc == 4 && std::strcmp(argv[1], "--diff") == 0) {
+        return diffDecisions(argv[2], argv[3]);
+    }
+    if (argc == 2) {
+        return replayRecording(argv[1], nullptr);
+    }
+    if (argc == 4 && std::strcmp(argv[2], "--decisions") == 0) {
+        return replayRecording(argv[1], argv[3]);
+    }
+
+    std::fprintf(stderr,
+                 "Usage:\n"
+                 "  %s <recording> [--decisions <out>]\n"
+                 "  %s --diff <decisions-a> <decisions-b>\n",
+                 argv[0], argv[0]);
+    return 2;
+}
@@ -0,0 +1,304 @@
+/**
+ * SYNAPSE Neural Connection Layer - Incremental Top-K Index
+ * =========================================================
+ *
+ * Keeps the "worst K components" for a metric up to date while scores
+ * stream in, so dashboards never have to sort the whole fleet.
+ *
+ * Author: SYNAPSE Framework Team
+ * License: MIT
+ */
+
+#ifndef SYNAPSE_TOPK_INDEX_HPP
+#define SYNAPSE_TOPK_INDEX_HPP
+
+#include "balancing_algorithm.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace synapse {
+namespace neural {
+
+// =============================================================================
+// TOP-K INDEX
+// =============================================================================
+
+/**
+ * Indexed Top-K structure keyed by ComponentHandle
+ *
+ * Two indexed binary heaps split the tracked components:
+ * - top_  : min-heap holding the K highest scores (root = K-th best)
+ * - rest_ : max-heap holding everything else (root = best outsider)
+ *
+ * A per-handle slot table gives O(1) lookup of a component's heap
+ * position, so a score update is a single sift. Updates to members of
+ * the top set cost O(log K); updates to outsiders cost O(log N) and
+ * only touch the top set when the best outsider overtakes the K-th
+ * entry. Higher score = ranked first.
+ *
+ * Not thread-safe; see WorstComponentsIndex for the locked wrapper.
+ */
+class TopKIndex {
+public:
+    struct Entry {
+        ComponentHandle handle;
+        double score;
+    };
+
+    explicit TopKIndex(size_t k) : k_(std::max<size_t>(k, 1)) {
+        top_.reserve(k_);
+    }
+
+    size_t capacity() const { return k_; }
+    size_t size() const { return top_.size() + rest_.size(); }
+
+    bool contains(ComponentHandle handle) const {
+        return handle < slots_.size() && slots_[handle].heap != NONE;
+    }
+
+    /**
+     * Insert or update the score of a component
+     */
+    void update(ComponentHandle handle, double score) {
+        if (handle >= slots_.size()) {
+            slots_.resize(static_cast<size_t>(handle) + 1);
+        }
+
+        Slot& slot = slots_[handle];
+        if (slot.heap == TOP) {
+            double old = top_[slot.pos].score;
+            top_[slot.pos].score = score;
+            if (score < old) siftUp(TOP, slot.pos); else siftDown(TOP, slot.pos);
+        } else if (slot.heap == REST) {
+            double old = rest_[slot.pos].score;
+            rest_[slot.pos].score = score;
+            if (score > old) siftUp(REST, slot.pos); else siftDown(REST, slot.pos);
+        } else if (top_.size() < k_) {
+            push(TOP, {handle, score});
+        } else {
+            push(REST, {handle, score});
+        }
+
+        rebalance();
+    }
+
+    /**
+     * Stop tracking a component (e.g. after deregistration)
+     */
+    void remove(ComponentHandle handle) {
+        if (!contains(handle)) return;
+
+        Slot slot = slots_[handle];
+        erase(slot.heap, slot.pos);
+
+        // Refill the top set from the best outsider
+        if (slot.heap == TOP && !rest_.empty()) {
+            Entry best = rest_.front();
+            erase(REST, 0);
+            push(TOP, best);
+        }
+    }
+
+    /**
+     * Copy of the current top-K, sorted worst-first
+     *
+     * Costs O(K log K) and never touches the outsider heap.
+     */
+    std::vector<Entry> snapshot() const {
+        std::vector<Entry> result;
+        snapshotInto(result);
+        return result;
+    }
+
+    void snapshotInto(std::vector<Entry>& out) const {
+        out.assign(top_.begin(), top_.end());
+        std::sort(out.begin(), out.end(), [](const Entry& a, const Entry& b) {
+            return a.score > b.score || (a.score == b.score && a.handle < b.handle);
+        });
+    }
+
+    /**
+     * Lowest score still inside the top-K (admission bar)
+     */
+    double threshold() const {
+        return top_.empty() ? 0.0 : top_.front().score;
+    }
+
+private:
+    enum HeapId : std::uint8_t { NONE = 0, TOP = 1, REST = 2 };
+
+    struct Slot {
+        std::uint8_t heap = NONE;
+        std::uint32_t pos = 0;
+    };
+
+    size_t k_;
+    std::vector<Entry> top_;
+    std::vector<Entry> rest_;
+    std::vector<Slot> slots_;
+
+    std::vector<Entry>& heap(std::uint8_t id) { return id == TOP ? top_ : rest_; }
+
+    // top_ is a min-heap, rest_ a max-heap
+    static bool before(std::uint8_t id, const Entry& a, const Entry& b) {
+        return id == TOP ? a.score < b.score : a.score > b.score;
+    }
+
+    void place(std::uint8_t id, size_t pos, const Entry& entry) {
+        heap(id)[pos] = entry;
+        slots_[entry.handle] = {id, static_cast<std::uint32_t>(pos)};
+    }
+
+    void siftUp(std::uint8_t id, size_t pos) {
+        auto& h = heap(id);
+        Entry entry = h[pos];
+        while (pos > 0) {
+            size_t parent = (pos - 1) / 2;
+            if (!before(id, entry, h[parent])) break;
+            place(id, pos, h[parent]);
+            pos = parent;
+        }
+        place(id, pos, entry);
+    }
+
+    void siftDown(std::uint8_t id, size_t pos) {
+        auto& h = heap(id);
+        Entry entry = h[pos];
+        const size_t n = h.size();
+        while (true) {
+            size_t child = 2 * pos + 1;
+            if (child >= n) break;
+            if (child + 1 < n && before(id, h[child + 1], h[child])) ++child;
+            if (!before(id, h[child], entry)) break;
+            place(id, pos, h[child]);
+            pos = child;
+        }
+        place(id, pos, entry);
+    }
+
+    void push(std::uint8_t id, const Entry& entry) {
+        auto& h = heap(id);
+        h.push_back(entry);
+        siftUp(id, h.size() - 1);
+    }
+
+    void erase(std::uint8_t id, size_t pos) {
+        auto& h = heap(id);
+        slots_[h[pos].handle] = {};
+
+        if (pos + 1 == h.size()) {
+            h.pop_back();
+            return;
+        }
+
+        Entry last = h.back();
+        h.pop_back();
+        place(id, pos, last);
+        siftUp(id, pos);
+        siftDown(id, slots_[last.handle].pos);
+    }
+
+    // Keep every top_ score >= every rest_ score
+    void rebalance() {
+        if (rest_.empty() || top_.empty()) return;
+        if (rest_.front().score <= top_.front().score) return;
+
+        Entry promoted = rest_.front();
+        Entry demoted = top_.front();
+        place(TOP, 0, promoted);
+        siftDown(TOP, 0);
+        place(REST, 0, demoted);
+        siftDown(REST, 0);
+    }
+};
+
+// =============================================================================
+// WORST COMPONENTS INDEX
+// =============================================================================
+
+enum class RankingMetric {
+    IDI,        // Highest IDI first
+    IMBALANCE,  // Most hardware-overloaded (most negative imbalance) first
+    THROTTLE    // Most throttled (lowest throttle level) first
+};
+
+/**
+ * Worst Components Index
+ *
+ * One TopKIndex per RankingMetric, fed from IDI and balancer results.
+ * Each metric has its own lock so IDI and telemetry ingestion do not
+ * contend with each other.
+ */
+class WorstComponentsIndex {
+private:
+    static constexpr size_t METRIC_COUNT = 3;
+
+    struct Ranked {
+        mutable std::mutex mutex;
+        TopKIndex index;
+        explicit Ranked(size_t k) : index(k) {}
+    };
+
+    Ranked ranked_[METRIC_COUNT];
+
+    Ranked& at(RankingMetric metric) { return ranked_[static_cast<size_t>(metric)]; }
+    const Ranked& at(RankingMetric metric) const { return ranked_[static_cast<size_t>(metric)]; }
+
+    void set(RankingMetric metric, ComponentHandle handle, double score) {
+        Ranked& r = at(metric);
+        std::lock_guard<std::mutex> lock(r.mutex);
+        r.index.update(handle, score);
+    }
+
+public:
+    explicit WorstComponentsIndex(size_t k = 50)
+        : ranked_{Ranked(k), Ranked(k), Ranked(k)} {}
+
+    void recordIdi(ComponentHandle handle, double idi) {
+        set(RankingMetric::IDI, handle, idi);
+    }
+
+    /**
+     * Record a HardwareSoftwareBalancer result (imbalance and throttle)
+     */
+    void recordBalance(ComponentHandle handle, const MitigationResult& result) {
+        set(RankingMetric::IMBALANCE, handle, -result.imbalance);
+        set(RankingMetric::THROTTLE, handle, 1.0 - result.throttle_level);
+    }
+
+    /**
+     * Record an IDIBrake result (IDI and throttle); a brake result has
+     * no imbalance, so the component's IMBALANCE rank is left alone
+     */
+    void recordBrake(ComponentHandle handle, const MitigationResult& result) {
+        set(RankingMetric::IDI, handle, result.idi_score);
+        set(RankingMetric::THROTTLE, handle, 1.0 - result.throttle_level);
+    }
+
+    void remove(ComponentHandle handle) {
+        for (auto& r : ranked_) {
+            std::lock_guard<std::mutex> lock(r.mutex);
+            r.index.remove(handle);
+        }
+    }
+
+    /**
+     * Worst-first snapshot for one metric
+     *
+     * Scores are in ranking space: IDI as-is, -imbalance, 1 - throttle.
+     */
+    std::vector<TopKIndex::Entry> top(RankingMetric metric) const {
+        const Ranked& r = at(metric);
+        std::lock_guard<std::mutex> lock(r.mutex);
+        return r.index.snapshot();
+    }
+};
+
+} // namespace neural
+} // namespace synapse
+
+#endif // SYNAPSE_TOPK_INDEX_HPP